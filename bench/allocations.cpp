@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include "allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<size_t> gAllocationCount{ 0 };
+
+void* allocate( size_t size )
+{
+   gAllocationCount.fetch_add( 1, std::memory_order_relaxed );
+   if ( auto p = std::malloc( size ? size : 1 ) )
+      return p;
+   throw std::bad_alloc();
+}
+}   // namespace
+
+void* operator new( size_t size )
+{
+   return allocate( size );
+}
+
+void* operator new[]( size_t size )
+{
+   return allocate( size );
+}
+
+void operator delete( void* p ) noexcept
+{
+   std::free( p );
+}
+
+void operator delete[]( void* p ) noexcept
+{
+   std::free( p );
+}
+
+void operator delete( void* p, size_t ) noexcept
+{
+   std::free( p );
+}
+
+void operator delete[]( void* p, size_t ) noexcept
+{
+   std::free( p );
+}
+
+namespace benchutil {
+
+size_t allocationCount()
+{
+   return gAllocationCount.load( std::memory_order_relaxed );
+}
+
+AllocationCounter::AllocationCounter()
+   : mStart( allocationCount() )
+{}
+
+void AllocationCounter::report( benchmark::State& state ) const
+{
+   auto count = allocationCount() - mStart;
+   state.counters["allocs/iter"] = benchmark::Counter(
+         static_cast<double>( count ), benchmark::Counter::kAvgIterations );
+}
+
+}   // namespace benchutil
@@ -0,0 +1,25 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace benchutil {
+
+// The number of calls to the global operator new since the program started.
+size_t allocationCount();
+
+// Reports the number of allocations per iteration of a benchmark in the
+// counter "allocs/iter".  Create the counter just before the benchmark loop.
+class AllocationCounter
+{
+   size_t mStart;
+
+public:
+   AllocationCounter();
+   void report( benchmark::State& state ) const;
+};
+
+}   // namespace benchutil
@@ -0,0 +1,54 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+struct SubcommandOptions : public argumentum::CommandOptions
+{
+   bool verbose = false;
+   int depth = 0;
+   std::string branch;
+   std::vector<std::string> paths;
+
+   using CommandOptions::CommandOptions;
+
+   void add_parameters( ParameterConfig& params ) override
+   {
+      params.add_parameter( verbose, "-v", "--verbose" );
+      params.add_parameter( depth, "--depth" ).nargs( 1 );
+      params.add_parameter( branch, "-b", "--branch" ).nargs( 1 );
+      params.add_parameter( paths, "paths" ).minargs( 0 );
+   }
+};
+
+std::string commandName( size_t i )
+{
+   return "command-" + std::to_string( i );
+}
+}   // namespace
+
+// Parse a command line that selects one of many subcommands.
+static void BM_ParseSubcommand( benchmark::State& state )
+{
+   auto commandCount = static_cast<size_t>( state.range( 0 ) );
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   for ( size_t i = 0; i < commandCount; ++i )
+      params.add_command<SubcommandOptions>( commandName( i ) );
+
+   std::vector<std::string> args{ commandName( commandCount / 2 ), "-v", "--depth", "3", "-b",
+      "main", "src" };
+   for ( auto _ : state ) {
+      auto res = parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   state.SetItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_ParseSubcommand )->Arg( 10 )->Arg( 150 );
@@ -0,0 +1,84 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// Completion queries for a partial command line answered by a session.  The
+// first query builds the trie of names, the later ones reuse it.
+
+#include "allocations.h"
+#include "startup.h"
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+using benchutil::SyntheticOptions;
+
+namespace {
+size_t optionCount( const benchmark::State& state )
+{
+   return static_cast<size_t>( state.range( 0 ) );
+}
+
+void runQueries( benchmark::State& state, const std::vector<std::string>& args )
+{
+   SyntheticOptions options( optionCount( state ) );
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout ).completion();
+   benchutil::defineSyntheticOptions( parser, options );
+
+   auto session = parse_session( parser );
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      strout.str( "" );
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+}
+}   // namespace
+
+// A prefix that matches 11 of the options.
+static void BM_CompleteOptionPrefix( benchmark::State& state )
+{
+   runQueries( state, { "__complete", "bash", "--option-1", "2", "--option-12" } );
+}
+BENCHMARK( BM_CompleteOptionPrefix )->Arg( 200 )->Arg( 3000 )->Arg( 10000 );
+
+// A prefix that matches no option.
+static void BM_CompleteUnknownPrefix( benchmark::State& state )
+{
+   runQueries( state, { "__complete", "zsh", "--other" } );
+}
+BENCHMARK( BM_CompleteUnknownPrefix )->Arg( 200 )->Arg( 3000 )->Arg( 10000 );
+
+// The trie is built for a new definition in every iteration like in a shell
+// that starts the program for each completion.  The definition is created and
+// destroyed outside of the measured time.
+static void BM_CompleteFirstQuery( benchmark::State& state )
+{
+   std::vector<std::string> args{ "__complete", "bash", "--option-12" };
+   SyntheticOptions options( optionCount( state ) );
+   std::stringstream strout;
+   std::optional<parse_session> session;
+   std::optional<argument_parser> parser;
+   for ( auto _ : state ) {
+      state.PauseTiming();
+      session.reset();
+      parser.emplace();
+      parser->config().cout( strout ).completion();
+      benchutil::defineSyntheticOptions( *parser, options );
+      session.emplace( *parser );
+      state.ResumeTiming();
+
+      auto& res = session->parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+}
+BENCHMARK( BM_CompleteFirstQuery )->Arg( 200 )->Arg( 3000 );
@@ -0,0 +1,93 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+std::vector<std::string> makeFloats( size_t count )
+{
+   std::mt19937 rng( 42 );
+   std::uniform_real_distribution<double> dist( -1e6, 1e6 );
+   std::vector<std::string> values;
+   values.reserve( count );
+   for ( size_t i = 0; i < count; ++i )
+      values.push_back( std::to_string( dist( rng ) ) );
+   return values;
+}
+
+std::vector<std::string> makeInts( size_t count )
+{
+   std::mt19937 rng( 42 );
+   std::uniform_int_distribution<long> dist( -1000000, 1000000 );
+   std::vector<std::string> values;
+   values.reserve( count );
+   for ( size_t i = 0; i < count; ++i )
+      values.push_back( std::to_string( dist( rng ) ) );
+   return values;
+}
+
+constexpr size_t valueCount = 200000;
+}   // namespace
+
+static void BM_ParseInt( benchmark::State& state )
+{
+   auto values = makeInts( valueCount );
+   for ( auto _ : state ) {
+      for ( auto& value : values )
+         benchmark::DoNotOptimize( parse_int<long>( value ) );
+   }
+   state.SetItemsProcessed( state.iterations() * values.size() );
+}
+BENCHMARK( BM_ParseInt );
+
+static void BM_ParseFloatStrtod( benchmark::State& state )
+{
+   auto values = makeFloats( valueCount );
+   for ( auto _ : state ) {
+      for ( auto& value : values )
+         benchmark::DoNotOptimize( parse_float_strtod<double>( value ) );
+   }
+   state.SetItemsProcessed( state.iterations() * values.size() );
+}
+BENCHMARK( BM_ParseFloatStrtod );
+
+#ifdef ARGUMENTUM_HAS_FLOAT_FROM_CHARS
+static void BM_ParseFloatFromChars( benchmark::State& state )
+{
+   auto values = makeFloats( valueCount );
+   for ( auto _ : state ) {
+      for ( auto& value : values )
+         benchmark::DoNotOptimize( parse_float_from_chars<double>( value ) );
+   }
+   state.SetItemsProcessed( state.iterations() * values.size() );
+}
+BENCHMARK( BM_ParseFloatFromChars );
+#endif
+
+// Parse a vector<double> as if it was read from a response file.
+static void BM_ParseFloatVector( benchmark::State& state )
+{
+   auto values = makeFloats( valueCount );
+   std::vector<std::string> args{ "--values" };
+   args.insert( args.end(), values.begin(), values.end() );
+
+   std::vector<double> target;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( target, "--values" ).minargs( 1 );
+
+   for ( auto _ : state ) {
+      target.clear();
+      auto res = parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   state.SetItemsProcessed( state.iterations() * values.size() );
+}
+BENCHMARK( BM_ParseFloatVector )->Unit( benchmark::kMillisecond );
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// Options that read environment variables when they are not in the input
+// arguments.  The environment has 5000 entries; a few of them are read by the
+// options.  The parser walks the environment once per parse; the baseline
+// looks up every variable separately like getenv does.
+
+#include "allocations.h"
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+
+namespace {
+constexpr size_t environmentSize = 5000;
+
+size_t variableCount( const benchmark::State& state )
+{
+   return static_cast<size_t>( state.range( 0 ) );
+}
+
+std::string variableName( size_t i )
+{
+   return "APP_OPTION_" + std::to_string( i );
+}
+
+// The entries of the environment and the array of pointers to them.  Every
+// declared variable is set.  The other entries have names like the ones found
+// in a container, some of them starting with the same letter.
+struct SyntheticEnvironment
+{
+   std::vector<std::string> entries;
+   std::vector<const char*> pointers;
+
+   explicit SyntheticEnvironment( size_t declaredCount )
+   {
+      static const char* prefixes[] = { "PATH_", "LC_", "XDG_", "KUBERNETES_", "AWS_" };
+      for ( size_t i = 0; entries.size() + declaredCount < environmentSize; ++i )
+         entries.push_back( prefixes[i % 5] + std::to_string( i ) + "=/some/value/" );
+
+      // The declared variables are spread evenly over the environment.
+      for ( size_t i = 0; i < declaredCount; ++i ) {
+         auto pos = ( i + 1 ) * entries.size() / ( declaredCount + 1 );
+         entries.insert( entries.begin() + pos, variableName( i ) + "=" + std::to_string( i ) );
+      }
+
+      for ( auto& entry : entries )
+         pointers.push_back( entry.c_str() );
+      pointers.push_back( nullptr );
+   }
+};
+
+const char* findVariable( const char* const* pEnvironment, const std::string& name )
+{
+   for ( auto pEntry = pEnvironment; *pEntry; ++pEntry )
+      if ( std::strncmp( *pEntry, name.c_str(), name.size() ) == 0
+            && ( *pEntry )[name.size()] == '=' )
+         return *pEntry + name.size() + 1;
+   return nullptr;
+}
+}   // namespace
+
+// The options declare the variables and a session parses an empty command
+// line.
+static void BM_EnvironmentParse( benchmark::State& state )
+{
+   SyntheticEnvironment environment( variableCount( state ) );
+   std::vector<int> values( variableCount( state ) );
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout ).environment( environment.pointers.data() );
+   auto params = parser.params();
+   for ( size_t i = 0; i < values.size(); ++i )
+      params.add_parameter( values[i], "--option-" + std::to_string( i ) )
+            .nargs( 1 )
+            .env( variableName( i ) );
+
+   std::vector<std::string> args;
+   auto session = parse_session( parser );
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_EnvironmentParse )->Arg( 1 )->Arg( 10 )->Arg( 100 );
+
+// The same options without variables; every variable is looked up and
+// converted after parsing like in a tool that calls getenv.
+static void BM_EnvironmentLookupEach( benchmark::State& state )
+{
+   SyntheticEnvironment environment( variableCount( state ) );
+   std::vector<int> values( variableCount( state ) );
+   std::vector<std::string> names;
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout );
+   auto params = parser.params();
+   for ( size_t i = 0; i < values.size(); ++i ) {
+      params.add_parameter( values[i], "--option-" + std::to_string( i ) ).nargs( 1 );
+      names.push_back( variableName( i ) );
+   }
+
+   std::vector<std::string> args;
+   auto session = parse_session( parser );
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+      for ( size_t i = 0; i < names.size(); ++i ) {
+         auto pValue = findVariable( environment.pointers.data(), names[i] );
+         if ( pValue )
+            values[i] = std::atoi( pValue );
+      }
+      benchmark::DoNotOptimize( values.data() );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_EnvironmentLookupEach )->Arg( 1 )->Arg( 10 )->Arg( 100 );
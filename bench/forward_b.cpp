@@ -0,0 +1,55 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+// Creates an option like --forward,--flag-0,--flag-1,... with @p count forwarded
+// arguments.  Every @p escapeEvery-th argument contains an escaped comma.
+std::string makeForwardedList( size_t count, size_t escapeEvery )
+{
+   std::string option = "--forward";
+   for ( size_t i = 0; i < count; ++i ) {
+      option += ",--flag-" + std::to_string( i );
+      if ( escapeEvery > 0 && i % escapeEvery == 0 )
+         option += ",,value";
+   }
+   return option;
+}
+
+void parseForwardedList( benchmark::State& state, size_t escapeEvery )
+{
+   auto count = static_cast<size_t>( state.range( 0 ) );
+   std::vector<std::string> args{ makeForwardedList( count, escapeEvery ) };
+
+   std::vector<std::string> forwarded;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( forwarded, "--forward" ).forward( true );
+
+   for ( auto _ : state ) {
+      auto res = parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+
+   state.SetItemsProcessed( state.iterations() * count );
+}
+}   // namespace
+
+static void BM_ForwardedList( benchmark::State& state )
+{
+   parseForwardedList( state, 0 );
+}
+BENCHMARK( BM_ForwardedList )->Arg( 10000 );
+
+static void BM_ForwardedListWithEscapes( benchmark::State& state )
+{
+   parseForwardedList( state, 10 );
+}
+BENCHMARK( BM_ForwardedListWithEscapes )->Arg( 10000 );
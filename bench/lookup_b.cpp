@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+std::string optionName( size_t i )
+{
+   return "--option-" + std::to_string( i );
+}
+
+// The names of the options that are used in input arguments, spread over the
+// whole definition.
+std::vector<std::string> selectNames( size_t optionCount, size_t selectCount )
+{
+   std::vector<std::string> names;
+   for ( size_t i = 0; i < selectCount; ++i )
+      names.push_back( optionName( ( i * optionCount ) / selectCount ) );
+   names.push_back( optionName( optionCount - 1 ) );
+   return names;
+}
+
+std::string commandName( size_t i )
+{
+   return "command-" + std::to_string( i );
+}
+
+struct BenchCommandOptions : public CommandOptions
+{
+   using CommandOptions::CommandOptions;
+};
+
+void defineOptions( argument_parser& parser, std::vector<int>& targets )
+{
+   auto params = parser.params();
+   for ( size_t i = 0; i < targets.size(); ++i )
+      params.add_parameter( targets[i], optionName( i ) ).nargs( 1 );
+}
+}   // namespace
+
+static void BM_FindOption( benchmark::State& state )
+{
+   auto optionCount = static_cast<size_t>( state.range( 0 ) );
+   std::vector<int> targets( optionCount );
+   auto parser = argument_parser{};
+   defineOptions( parser, targets );
+
+   // Complete the definition.
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   benchmark::DoNotOptimize( static_cast<bool>( res ) );
+
+   auto names = selectNames( optionCount, 8 );
+   const auto& parserDef = parser.getDefinition();
+   for ( auto _ : state ) {
+      for ( auto& name : names )
+         benchmark::DoNotOptimize( parserDef.findOption( name ) );
+   }
+
+   state.SetItemsProcessed( state.iterations() * names.size() );
+}
+BENCHMARK( BM_FindOption )->RangeMultiplier( 10 )->Range( 10, 10000 );
+
+static void BM_FindCommand( benchmark::State& state )
+{
+   auto commandCount = static_cast<size_t>( state.range( 0 ) );
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   for ( size_t i = 0; i < commandCount; ++i )
+      params.add_command<BenchCommandOptions>( commandName( i ) );
+
+   // Complete the definition.
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   benchmark::DoNotOptimize( static_cast<bool>( res ) );
+
+   std::vector<std::string> names;
+   for ( size_t i = 0; i < 8; ++i )
+      names.push_back( commandName( ( i * commandCount ) / 8 ) );
+   const auto& parserDef = parser.getDefinition();
+   for ( auto _ : state ) {
+      for ( auto& name : names )
+         benchmark::DoNotOptimize( parserDef.matchCommand( name ) );
+   }
+
+   state.SetItemsProcessed( state.iterations() * names.size() );
+}
+BENCHMARK( BM_FindCommand )->RangeMultiplier( 10 )->Range( 10, 1000 );
+
+static void BM_ParseKnownOptions( benchmark::State& state )
+{
+   auto optionCount = static_cast<size_t>( state.range( 0 ) );
+   std::vector<int> targets( optionCount );
+   auto parser = argument_parser{};
+   defineOptions( parser, targets );
+
+   std::vector<std::string> args;
+   for ( auto& name : selectNames( optionCount, 8 ) ) {
+      args.push_back( name );
+      args.push_back( "42" );
+   }
+
+   for ( auto _ : state ) {
+      auto res = parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+
+   state.SetItemsProcessed( state.iterations() * args.size() );
+}
+BENCHMARK( BM_ParseKnownOptions )->RangeMultiplier( 10 )->Range( 10, 10000 );
@@ -0,0 +1,209 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// The throughput of argument_parser::parse_args as the shape of the input
+// grows.  Every benchmark reports the number of allocations per parse.
+
+#include "allocations.h"
+
+#include <argumentum/argparse.h>
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+
+namespace {
+// A filesystem with the included files in memory so that the benchmarks do
+// not depend on the disk.
+class MemoryFilesystem : public Filesystem
+{
+   std::map<std::string, std::vector<std::string>> mFiles;
+
+public:
+   std::unique_ptr<ArgumentStream> open( const std::string& filename ) override
+   {
+      auto it = mFiles.find( filename );
+      if ( it == mFiles.end() )
+         return nullptr;
+
+      using iter_t = std::vector<std::string>::const_iterator;
+      return std::make_unique<IteratorArgumentStream<iter_t>>(
+            it->second.cbegin(), it->second.cend() );
+   }
+
+   void addFile( const std::string& name, std::vector<std::string> content )
+   {
+      mFiles[name] = std::move( content );
+   }
+};
+
+struct NestedCommand : public CommandOptions
+{
+   int depth;
+   int value = 0;
+
+   NestedCommand( std::string_view name, int depth )
+      : CommandOptions( name )
+      , depth( depth )
+   {}
+
+   void add_parameters( ParameterConfig& params ) override
+   {
+      params.add_parameter( value, "--value" ).nargs( 1 );
+      if ( depth > 1 ) {
+         auto childDepth = depth - 1;
+         params.add_command( "sub", [childDepth]( std::string_view name ) {
+            return std::make_shared<NestedCommand>( name, childDepth );
+         } );
+      }
+   }
+};
+
+void runParse( benchmark::State& state, argument_parser& parser,
+      const std::vector<std::string>& args, size_t argumentCount )
+{
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto res = parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+
+   allocations.report( state );
+   state.SetItemsProcessed( state.iterations() * argumentCount );
+}
+}   // namespace
+
+// The number of defined options grows, the input has 16 arguments.
+static void BM_ParseByOptionCount( benchmark::State& state )
+{
+   auto optionCount = static_cast<size_t>( state.range( 0 ) );
+   std::vector<int> targets( optionCount );
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   for ( size_t i = 0; i < optionCount; ++i )
+      params.add_parameter( targets[i], "--option-" + std::to_string( i ) ).nargs( 1 );
+
+   std::vector<std::string> args;
+   for ( size_t i = 0; i < 8; ++i ) {
+      args.push_back( "--option-" + std::to_string( ( i * optionCount ) / 8 ) );
+      args.push_back( std::to_string( i ) );
+   }
+
+   runParse( state, parser, args, args.size() );
+}
+BENCHMARK( BM_ParseByOptionCount )->RangeMultiplier( 10 )->Range( 10, 1000 );
+
+// The number of input arguments grows, the parser has 4 options.
+static void BM_ParseByArgumentCount( benchmark::State& state )
+{
+   auto argumentCount = static_cast<size_t>( state.range( 0 ) );
+   bool verbose = false;
+   int level = 0;
+   std::string output;
+   std::vector<std::string> files;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( verbose, "-v", "--verbose" );
+   params.add_parameter( level, "-l", "--level" ).nargs( 1 );
+   params.add_parameter( output, "-o", "--output" ).nargs( 1 );
+   params.add_parameter( files, "files" ).minargs( 1 );
+
+   std::vector<std::string> args{ "-v", "--level", "3", "-o", "out.txt" };
+   for ( size_t i = args.size(); i < argumentCount; ++i )
+      args.push_back( "file-" + std::to_string( i ) + ".txt" );
+
+   runParse( state, parser, args, args.size() );
+}
+BENCHMARK( BM_ParseByArgumentCount )->RangeMultiplier( 10 )->Range( 10, 10000 );
+
+// The number of short options in a single bundle like -abcd grows.
+static void BM_ParseShortOptionBundle( benchmark::State& state )
+{
+   auto bundleSize = static_cast<size_t>( state.range( 0 ) );
+   std::array<bool, 26> flags{};
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   std::string bundle = "-";
+   for ( size_t i = 0; i < bundleSize; ++i ) {
+      auto name = std::string{ '-', char( 'a' + i ) };
+      params.add_parameter( flags[i], name );
+      bundle += char( 'a' + i );
+   }
+
+   std::vector<std::string> args( 8, bundle );
+   runParse( state, parser, args, args.size() * bundleSize );
+}
+BENCHMARK( BM_ParseShortOptionBundle )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Arg( 26 );
+
+// The number of forwarded arguments in a --forward,a,b,... list grows.
+static void BM_ParseForwardedList( benchmark::State& state )
+{
+   auto listLength = static_cast<size_t>( state.range( 0 ) );
+   std::vector<std::string> forwarded;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( forwarded, "--forward" ).forward( true );
+
+   std::string list = "--forward";
+   for ( size_t i = 0; i < listLength; ++i )
+      list += ",-f" + std::to_string( i );
+
+   std::vector<std::string> args{ list };
+   runParse( state, parser, args, listLength );
+}
+BENCHMARK( BM_ParseForwardedList )->RangeMultiplier( 10 )->Range( 10, 1000 );
+
+// The depth of nested @includes grows.  Every file has 8 arguments.
+static void BM_ParseIncludeDepth( benchmark::State& state )
+{
+   auto depth = static_cast<size_t>( state.range( 0 ) );
+   std::vector<std::string> files;
+   auto pFilesystem = std::make_shared<MemoryFilesystem>();
+   for ( size_t i = 0; i < depth; ++i ) {
+      std::vector<std::string> content;
+      for ( size_t j = 0; j < 8; ++j )
+         content.push_back( "file-" + std::to_string( i ) + "-" + std::to_string( j ) );
+      if ( i + 1 < depth )
+         content.push_back( "@include-" + std::to_string( i + 1 ) );
+      pFilesystem->addFile( "include-" + std::to_string( i ), std::move( content ) );
+   }
+
+   auto parser = argument_parser{};
+   parser.config().filesystem( pFilesystem );
+   auto params = parser.params();
+   params.add_parameter( files, "files" ).minargs( 1 );
+
+   std::vector<std::string> args{ "@include-0" };
+   runParse( state, parser, args, depth * 8 );
+}
+BENCHMARK( BM_ParseIncludeDepth )->Arg( 1 )->Arg( 4 )->Arg( 8 );
+
+// The depth of nested commands grows: cmd sub sub ...
+static void BM_ParseCommandDepth( benchmark::State& state )
+{
+   auto depth = static_cast<int>( state.range( 0 ) );
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_command( "cmd", [depth]( std::string_view name ) {
+      return std::make_shared<NestedCommand>( name, depth );
+   } );
+
+   std::vector<std::string> args{ "cmd", "--value", "1" };
+   for ( int i = 1; i < depth; ++i ) {
+      args.push_back( "sub" );
+      args.push_back( "--value" );
+      args.push_back( std::to_string( i + 1 ) );
+   }
+
+   runParse( state, parser, args, args.size() );
+}
+BENCHMARK( BM_ParseCommandDepth )->Arg( 1 )->Arg( 2 )->Arg( 4 );
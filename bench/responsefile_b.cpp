@@ -0,0 +1,104 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+// A response file with a list of generated file names, one per line.
+std::string writeResponseFile( size_t lineCount )
+{
+   auto filename = std::string{ "argumentum-bench-" } + std::to_string( lineCount ) + ".opt";
+   std::ofstream f( filename, std::ios::binary );
+   for ( size_t i = 0; i < lineCount; ++i )
+      f << "build/generated/sources/module-" << i % 97 << "/file-" << i << ".cpp\n";
+   return filename;
+}
+
+size_t countArguments( ArgumentStream& stream )
+{
+   size_t bytes = 0;
+   for ( auto arg = stream.next(); arg; arg = stream.next() )
+      bytes += arg->size() + 1;
+   return bytes;
+}
+}   // namespace
+
+static void BM_ReadResponseFileGetline( benchmark::State& state )
+{
+   auto filename = writeResponseFile( static_cast<size_t>( state.range( 0 ) ) );
+   size_t bytes = 0;
+   for ( auto _ : state ) {
+      auto stream = StdStreamArgumentStream( std::make_shared<std::ifstream>( filename ) );
+      bytes += countArguments( stream );
+   }
+
+   state.SetBytesProcessed( static_cast<int64_t>( bytes ) );
+   std::remove( filename.c_str() );
+}
+BENCHMARK( BM_ReadResponseFileGetline )->RangeMultiplier( 100 )->Range( 100, 1000000 );
+
+static void BM_ReadResponseFileMapped( benchmark::State& state )
+{
+   auto filename = writeResponseFile( static_cast<size_t>( state.range( 0 ) ) );
+   size_t bytes = 0;
+   for ( auto _ : state ) {
+      auto pStream = MappedFileArgumentStream::open( filename );
+      if ( !pStream ) {
+         state.SkipWithError( "The file can not be mapped." );
+         break;
+      }
+      bytes += countArguments( *pStream );
+   }
+
+   state.SetBytesProcessed( static_cast<int64_t>( bytes ) );
+   std::remove( filename.c_str() );
+}
+BENCHMARK( BM_ReadResponseFileMapped )->RangeMultiplier( 100 )->Range( 100, 1000000 );
+
+static void BM_ReadResponseFileQuoted( benchmark::State& state )
+{
+   auto filename = writeResponseFile( static_cast<size_t>( state.range( 0 ) ) );
+   size_t bytes = 0;
+   for ( auto _ : state ) {
+      auto pStream = QuotedArgumentStream::open( filename );
+      if ( !pStream ) {
+         state.SkipWithError( "The file can not be opened." );
+         break;
+      }
+      bytes += countArguments( *pStream );
+   }
+
+   state.SetBytesProcessed( static_cast<int64_t>( bytes ) );
+   std::remove( filename.c_str() );
+}
+BENCHMARK( BM_ReadResponseFileQuoted )->RangeMultiplier( 100 )->Range( 100, 1000000 );
+
+// Parse a command line that includes the same small file of options.
+static void BM_ParseInclude( benchmark::State& state )
+{
+   auto filename = writeResponseFile( 20 );
+   std::vector<std::string> files;
+   auto parser = argument_parser{};
+   if ( state.range( 0 ) )
+      parser.config().filesystem( std::make_shared<CachingFilesystem>() );
+   auto params = parser.params();
+   params.add_parameter( files, "files" ).minargs( 1 );
+
+   auto args = std::vector<std::string>{ "@" + filename };
+   for ( auto _ : state ) {
+      auto res = parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+
+   state.SetLabel( state.range( 0 ) ? "cached" : "uncached" );
+   std::remove( filename.c_str() );
+}
+BENCHMARK( BM_ParseInclude )->Arg( 0 )->Arg( 1 );
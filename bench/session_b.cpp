@@ -0,0 +1,106 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include "allocations.h"
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+
+namespace {
+struct JobOptions
+{
+   bool verbose = false;
+   int priority = 0;
+   long timeout = 0;
+   std::string queue;
+   std::vector<std::string> inputs;
+};
+
+void defineOptions( argument_parser& parser, JobOptions& options )
+{
+   auto params = parser.params();
+   params.add_parameter( options.verbose, "-v", "--verbose" );
+   params.add_parameter( options.priority, "-p", "--priority" ).nargs( 1 );
+   params.add_parameter( options.timeout, "--timeout" ).nargs( 1 );
+   params.add_parameter( options.queue, "-q", "--queue" ).nargs( 1 );
+   params.add_parameter( options.inputs, "inputs" ).minargs( 1 );
+}
+
+// One incoming request.  The values are short so that the strings of the
+// targets do not allocate.
+const std::vector<std::string_view> requestArgs{ "-v", "--priority", "3", "--timeout=250",
+   "-q", "batch", "a.txt", "b.txt" };
+
+void setParseRate( benchmark::State& state )
+{
+   state.counters["parses/s"] =
+         benchmark::Counter( static_cast<double>( state.iterations() ), benchmark::Counter::kIsRate );
+}
+}   // namespace
+
+// Parse every request with argument_parser::parse_args.
+static void BM_RepeatedParseArgs( benchmark::State& state )
+{
+   JobOptions options;
+   auto parser = argument_parser{};
+   defineOptions( parser, options );
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto res = parser.parse_args( requestArgs );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+   setParseRate( state );
+}
+BENCHMARK( BM_RepeatedParseArgs );
+
+// Parse every request with a reusable parse_session.
+static void BM_RepeatedParseSession( benchmark::State& state )
+{
+   JobOptions options;
+   auto parser = argument_parser{};
+   defineOptions( parser, options );
+
+   auto session = parse_session( parser );
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto& res = session.parse_args( requestArgs );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+   setParseRate( state );
+}
+BENCHMARK( BM_RepeatedParseSession );
+
+// Parse untrusted requests where most arguments are rejected.
+static void BM_RepeatedParseErrors( benchmark::State& state )
+{
+   JobOptions options;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   defineOptions( parser, options );
+
+   std::vector<std::string_view> badArgs{ "--unknown-option-with-a-long-name", "-p",
+      "not-a-number", "--timeout=never", "--another-unknown-option", "--yet-another-unknown",
+      "a.txt" };
+   auto session = parse_session( parser );
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto& res = session.parse_args( badArgs );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+      strout.str( {} );
+   }
+   allocations.report( state );
+   setParseRate( state );
+}
+BENCHMARK( BM_RepeatedParseErrors );
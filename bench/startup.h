@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <argumentum/argparse.h>
+
+#include <string>
+#include <vector>
+
+namespace benchutil {
+
+// The targets of a synthetic program with many options.  Every tenth option is
+// a flag and the others take a value.  The options are split into groups of
+// 100 and every other group is exclusive.
+struct SyntheticOptions
+{
+   std::vector<int> values;
+   std::vector<std::string> inputs;
+
+   explicit SyntheticOptions( size_t optionCount )
+      : values( optionCount )
+   {}
+};
+
+inline void defineSyntheticOptions(
+      argumentum::argument_parser& parser, SyntheticOptions& options )
+{
+   auto params = parser.params();
+   auto optionCount = options.values.size();
+   for ( size_t i = 0; i < optionCount; ++i ) {
+      if ( i % 100 == 0 ) {
+         if ( i > 0 )
+            params.end_group();
+         auto name = "group-" + std::to_string( i / 100 );
+         if ( ( i / 100 ) % 2 )
+            params.add_exclusive_group( name );
+         else
+            params.add_group( name );
+      }
+
+      auto name = "--option-" + std::to_string( i );
+      if ( i % 10 == 0 )
+         params.add_parameter( options.values[i], name ).maxargs( 0 ).help( "A flag." );
+      else
+         params.add_parameter( options.values[i], name ).nargs( 1 ).help( "A value." );
+   }
+
+   if ( optionCount > 0 )
+      params.end_group();
+
+   params.add_parameter( options.inputs, "inputs" ).minargs( 0 ).help( "The input files." );
+}
+
+// A typical command line for the synthetic program.  It sets up to 8 value
+// options from the groups that are not exclusive.
+inline std::vector<std::string> syntheticArguments( size_t optionCount )
+{
+   std::vector<std::string> args;
+   for ( size_t k = 0; k < 8 && optionCount > 1; ++k ) {
+      auto i = ( k * optionCount ) / 8;
+      if ( ( i / 100 ) % 2 )
+         i -= 100;
+      i = i - i % 10 + 1;
+      if ( i >= optionCount )
+         break;
+      args.push_back( "--option-" + std::to_string( i ) );
+      args.push_back( std::to_string( k ) );
+   }
+   args.push_back( "input.txt" );
+   return args;
+}
+
+}   // namespace benchutil
@@ -0,0 +1,171 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// The cost of starting a program with many options, split into phases:
+// defining the options, the first parse that verifies and indexes the
+// definition, a later parse, the first help and the whole process.
+
+#include "allocations.h"
+#include "startup.h"
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <sstream>
+
+#if __has_include( <spawn.h> ) && __has_include( <sys/wait.h> )
+#include <spawn.h>
+#include <sys/wait.h>
+#define HAVE_SPAWN 1
+#else
+#define HAVE_SPAWN 0
+#endif
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+using benchutil::SyntheticOptions;
+
+namespace {
+struct SyntheticProgram
+{
+   SyntheticOptions options;
+   std::stringstream strout;
+   argument_parser parser;
+
+   explicit SyntheticProgram( size_t optionCount )
+      : options( optionCount )
+   {
+      parser.config().cout( strout );
+      benchutil::defineSyntheticOptions( parser, options );
+   }
+};
+
+size_t optionCount( const benchmark::State& state )
+{
+   return static_cast<size_t>( state.range( 0 ) );
+}
+}   // namespace
+
+// Phase 1: create the parser and define the options.
+static void BM_StartupDefine( benchmark::State& state )
+{
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto pProgram = std::make_unique<SyntheticProgram>( optionCount( state ) );
+      benchmark::DoNotOptimize( pProgram.get() );
+
+      state.PauseTiming();
+      pProgram.reset();
+      state.ResumeTiming();
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_StartupDefine )->Arg( 10 )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
+
+// Phase 2: the first parse verifies the definition and builds the indices.
+static void BM_StartupFirstParse( benchmark::State& state )
+{
+   auto args = benchutil::syntheticArguments( optionCount( state ) );
+   size_t allocationCount = 0;
+   for ( auto _ : state ) {
+      state.PauseTiming();
+      auto pProgram = std::make_unique<SyntheticProgram>( optionCount( state ) );
+      auto allocationsBefore = benchutil::allocationCount();
+      state.ResumeTiming();
+
+      auto res = pProgram->parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+
+      state.PauseTiming();
+      allocationCount += benchutil::allocationCount() - allocationsBefore;
+      pProgram.reset();
+      state.ResumeTiming();
+   }
+   state.counters["allocs/iter"] = benchmark::Counter(
+         static_cast<double>( allocationCount ), benchmark::Counter::kAvgIterations );
+}
+BENCHMARK( BM_StartupFirstParse )->Arg( 10 )->Arg( 200 )->Arg( 2000 );
+
+// Phase 3: the later parses use the verified definition.
+static void BM_StartupNextParse( benchmark::State& state )
+{
+   auto args = benchutil::syntheticArguments( optionCount( state ) );
+   SyntheticProgram program( optionCount( state ) );
+   auto first = program.parser.parse_args( args );
+   benchmark::DoNotOptimize( static_cast<bool>( first ) );
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto res = program.parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_StartupNextParse )->Arg( 10 )->Arg( 200 )->Arg( 2000 );
+
+// Phase 4: the first --help formats the descriptions of all options.
+static void BM_StartupFirstHelp( benchmark::State& state )
+{
+   std::vector<std::string> args{ "--help" };
+   for ( auto _ : state ) {
+      state.PauseTiming();
+      auto pProgram = std::make_unique<SyntheticProgram>( optionCount( state ) );
+      state.ResumeTiming();
+
+      auto res = pProgram->parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+
+      state.PauseTiming();
+      pProgram.reset();
+      state.ResumeTiming();
+   }
+}
+BENCHMARK( BM_StartupFirstHelp )->Arg( 10 )->Arg( 200 )->Arg( 2000 );
+
+// Phase 5: a later --help is served from the help cache of the definition.
+static void BM_StartupNextHelp( benchmark::State& state )
+{
+   std::vector<std::string> args{ "--help" };
+   SyntheticProgram program( optionCount( state ) );
+   auto first = program.parser.parse_args( args );
+   benchmark::DoNotOptimize( static_cast<bool>( first ) );
+
+   for ( auto _ : state ) {
+      program.strout.str( "" );
+      auto res = program.parser.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+}
+BENCHMARK( BM_StartupNextHelp )->Arg( 10 )->Arg( 200 )->Arg( 2000 );
+
+#if HAVE_SPAWN && defined( ARGUMENTUM_STARTUP_PROGRAM )
+// All phases together with the start and the exit of a process.  The
+// difference to the run with 0 options is the cost of the parser.
+static void BM_StartupProcess( benchmark::State& state )
+{
+   auto count = std::to_string( optionCount( state ) );
+   auto args = benchutil::syntheticArguments( optionCount( state ) );
+   std::vector<char*> argv;
+   std::string program = ARGUMENTUM_STARTUP_PROGRAM;
+   argv.push_back( program.data() );
+   argv.push_back( count.data() );
+   for ( auto& arg : args )
+      argv.push_back( arg.data() );
+   argv.push_back( nullptr );
+
+   for ( auto _ : state ) {
+      pid_t pid;
+      if ( posix_spawn( &pid, program.c_str(), nullptr, nullptr, argv.data(), environ ) != 0 ) {
+         state.SkipWithError( "The synthetic program could not be started." );
+         break;
+      }
+
+      int status = 0;
+      waitpid( pid, &status, 0 );
+      if ( !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+         state.SkipWithError( "The synthetic program failed." );
+         break;
+      }
+   }
+}
+BENCHMARK( BM_StartupProcess )->Arg( 0 )->Arg( 10 )->Arg( 200 )->Arg( 2000 )->UseRealTime();
+#endif
@@ -0,0 +1,23 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// A synthetic program that is started by BM_StartupProcess.  The first
+// argument is the number of options to define, the rest are parsed.
+
+#include "startup.h"
+
+#include <cstdlib>
+
+int main( int argc, char** argv )
+{
+   if ( argc < 2 )
+      return 2;
+
+   auto optionCount = static_cast<size_t>( std::strtoul( argv[1], nullptr, 10 ) );
+   auto options = benchutil::SyntheticOptions( optionCount );
+   auto parser = argumentum::argument_parser{};
+   benchutil::defineSyntheticOptions( parser, options );
+
+   auto res = parser.parse_args( argc, argv, 2 );
+   return res ? 0 : 1;
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include "allocations.h"
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+struct SidecarOptions
+{
+   bool verbose = false;
+   bool dryRun = false;
+   int port = 0;
+   long timeout = 0;
+   double ratio = 0;
+   std::vector<std::string> files;
+};
+
+struct SidecarSchema
+{
+   static constexpr auto parameters = make_static_schema(
+         static_option( "-v", "--verbose", &SidecarOptions::verbose ),
+         static_option( "-n", "--dry-run", &SidecarOptions::dryRun ),
+         static_option( "-p", "--port", &SidecarOptions::port ).nargs( 1 ),
+         static_option( "--timeout", &SidecarOptions::timeout ).nargs( 1 ),
+         static_option( "--ratio", &SidecarOptions::ratio ).nargs( 1 ),
+         static_positional( "files", &SidecarOptions::files ) );
+};
+
+const std::vector<std::string> sidecarArgs{ "-vn", "--port", "8080", "--timeout=250",
+   "--ratio", "0.75", "a.txt", "b.txt" };
+}   // namespace
+
+// Define and parse with the static parser.
+static void BM_StaticParser( benchmark::State& state )
+{
+   benchutil::AllocationCounter allocations;
+   for ( auto _ : state ) {
+      SidecarOptions options;
+      static_parser<SidecarSchema> parser;
+      auto res = parser.parse_args( options, sidecarArgs );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   state.SetItemsProcessed( state.iterations() );
+   allocations.report( state );
+}
+BENCHMARK( BM_StaticParser );
+
+// Define and parse the same options with argument_parser.
+static void BM_DynamicParser( benchmark::State& state )
+{
+   for ( auto _ : state ) {
+      SidecarOptions options;
+      auto parser = argument_parser{};
+      auto params = parser.params();
+      params.add_parameter( options.verbose, "-v", "--verbose" );
+      params.add_parameter( options.dryRun, "-n", "--dry-run" );
+      params.add_parameter( options.port, "-p", "--port" ).nargs( 1 );
+      params.add_parameter( options.timeout, "--timeout" ).nargs( 1 );
+      params.add_parameter( options.ratio, "--ratio" ).nargs( 1 );
+      params.add_parameter( options.files, "files" );
+      auto res = parser.parse_args( sidecarArgs );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   state.SetItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_DynamicParser );
@@ -0,0 +1,202 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// The names that are suggested for an unknown option.  They are searched only
+// when an option is not found; the index of the names is built before the
+// measured loop.
+
+#include "allocations.h"
+#include "startup.h"
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+using benchutil::SyntheticOptions;
+
+namespace {
+size_t optionCount( const benchmark::State& state )
+{
+   return static_cast<size_t>( state.range( 0 ) );
+}
+
+// Option names made of two words of random syllables, like --kelo-mirasu.
+// The generator is fixed so that every run uses the same names.
+std::vector<std::string> wordNames( size_t count )
+{
+   static const char* syllables[] = { "ba", "ke", "lo", "mi", "nu", "ra", "se", "ti", "vo", "zu",
+      "da", "fe", "go", "hi", "ju", "pa", "re", "so", "tu", "wi" };
+   uint32_t state = 12345;
+   auto next = [&]( uint32_t range ) {
+      state = state * 1664525 + 1013904223;
+      return ( state >> 8 ) % range;
+   };
+   auto word = [&]() {
+      std::string word;
+      for ( auto i = 2 + next( 2 ); i > 0; --i )
+         word += syllables[next( 20 )];
+      return word;
+   };
+
+   std::unordered_set<std::string> used;
+   std::vector<std::string> names;
+   while ( names.size() < count ) {
+      auto name = "--" + word() + "-" + word();
+      if ( used.insert( name ).second )
+         names.push_back( name );
+   }
+   return names;
+}
+
+// A swapped, a replaced, a missing and an extra character in defined names,
+// and a name that is not similar to any option.  They are one edit away.
+std::vector<std::string> makeTypos( const std::vector<std::string>& names )
+{
+   auto swapped = names[names.size() / 5];
+   std::swap( swapped[4], swapped[5] );
+   auto replaced = names[2 * names.size() / 5];
+   replaced[6] = 'x';
+   auto missing = names[3 * names.size() / 5];
+   missing.erase( 3, 1 );
+   auto extra = names[4 * names.size() / 5];
+   extra.insert( 7, "q" );
+   return { swapped, replaced, missing, extra, "--verbose" };
+}
+
+// Two characters are replaced in defined names with at least eight characters
+// after the dashes.  The trie is searched because no name is one edit away.
+std::vector<std::string> makeTwoEditTypos( const std::vector<std::string>& names )
+{
+   std::vector<std::string> typos;
+   for ( size_t i = 1; typos.size() < 5; ++i ) {
+      auto typo = names[i * names.size() / 7 % names.size()];
+      if ( typo.size() < 10 )
+         continue;
+      typo[3] = 'x';
+      typo[typo.size() - 2] = 'y';
+      typos.push_back( typo );
+   }
+   return typos;
+}
+
+void defineWordOptions(
+      argument_parser& parser, const std::vector<std::string>& names, std::vector<int>& targets )
+{
+   auto params = parser.params();
+   for ( size_t i = 0; i < names.size(); ++i )
+      params.add_parameter( targets[i], names[i] ).nargs( 1 );
+}
+
+void runSuggestions( benchmark::State& state, argument_parser& parser,
+      const std::vector<std::string>& typos )
+{
+   auto session = parse_session( parser );
+   const auto& parserDef = parser.getDefinition();
+   ParseContext context;
+   context.findSimilarOptions( parserDef, "--build-the-index" );
+
+   size_t found = 0;
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      for ( auto& name : typos )
+         found += context.findSimilarOptions( parserDef, name ).size();
+   }
+   benchmark::DoNotOptimize( found );
+   state.SetItemsProcessed( state.iterations() * typos.size() );
+   allocations.report( state );
+}
+}   // namespace
+
+// The lookup of the names that are one edit away.  The time is reported for
+// five queries; items_per_second is the rate of single queries.
+static void BM_SuggestSimilarOptions( benchmark::State& state )
+{
+   auto names = wordNames( optionCount( state ) );
+   std::vector<int> targets( names.size() );
+   argument_parser parser;
+   defineWordOptions( parser, names, targets );
+
+   runSuggestions( state, parser, makeTypos( names ) );
+}
+BENCHMARK( BM_SuggestSimilarOptions )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
+
+// The search in the trie for the names that are two edits away.
+static void BM_SuggestTwoEdits( benchmark::State& state )
+{
+   auto names = wordNames( optionCount( state ) );
+   std::vector<int> targets( names.size() );
+   argument_parser parser;
+   defineWordOptions( parser, names, targets );
+
+   runSuggestions( state, parser, makeTwoEditTypos( names ) );
+}
+BENCHMARK( BM_SuggestTwoEdits )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
+
+// The synthetic names --option-N differ only in a few digits, so many of them
+// are similar to a typo.
+static void BM_SuggestSimilarSyntheticOptions( benchmark::State& state )
+{
+   SyntheticOptions options( optionCount( state ) );
+   argument_parser parser;
+   benchutil::defineSyntheticOptions( parser, options );
+
+   runSuggestions( state, parser,
+         { "--optoin-123", "--option-1x3", "--opton-123", "--option-1234x", "--verbose" } );
+}
+BENCHMARK( BM_SuggestSimilarSyntheticOptions )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
+
+// A session parses a command line with an unknown option.  The error with the
+// suggestions is added to the result.
+static void BM_SuggestInParse( benchmark::State& state )
+{
+   auto names = wordNames( optionCount( state ) );
+   std::vector<int> targets( names.size() );
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout );
+   defineWordOptions( parser, names, targets );
+
+   std::vector<std::string> args{ makeTypos( names ).front(), "1" };
+   auto session = parse_session( parser );
+   session.parse_args( args );
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      strout.str( "" );
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_SuggestInParse )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
+
+// A new session for every command line with an unknown option.  The indices
+// of the names are shared by the sessions and built only once.
+static void BM_SuggestInNewSession( benchmark::State& state )
+{
+   auto names = wordNames( optionCount( state ) );
+   std::vector<int> targets( names.size() );
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout );
+   defineWordOptions( parser, names, targets );
+
+   std::vector<std::string> args{ makeTypos( names ).front(), "1" };
+   auto firstSession = parse_session( parser );
+   benchmark::DoNotOptimize( static_cast<bool>( firstSession.parse_args( args ) ) );
+
+   for ( auto _ : state ) {
+      strout.str( "" );
+      auto session = parse_session( parser );
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+}
+BENCHMARK( BM_SuggestInNewSession )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// The loops that run over all options in every parse: the options are reset
+// before the arguments are parsed, the defaults are assigned and the required
+// options and the groups are checked after that.  The command line is short so
+// that the loops dominate on large definitions.
+
+#include "allocations.h"
+#include "startup.h"
+
+#include <argumentum/argparse.h>
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+using benchutil::SyntheticOptions;
+
+namespace {
+size_t optionCount( const benchmark::State& state )
+{
+   return static_cast<size_t>( state.range( 0 ) );
+}
+
+// Options in required groups of 100 where every option has a default.
+void defineOptionsWithDefaults( argument_parser& parser, SyntheticOptions& options )
+{
+   auto params = parser.params();
+   auto optionCount = options.values.size();
+   for ( size_t i = 0; i < optionCount; ++i ) {
+      if ( i % 100 == 0 ) {
+         if ( i > 0 )
+            params.end_group();
+         params.add_group( "group-" + std::to_string( i / 100 ) ).required();
+      }
+
+      auto name = "--option-" + std::to_string( i );
+      params.add_parameter( options.values[i], name ).nargs( 1 ).absent( int( i ) );
+   }
+
+   if ( optionCount > 0 )
+      params.end_group();
+
+   params.add_parameter( options.inputs, "inputs" ).minargs( 0 );
+}
+
+// Sets the first option of every group.
+std::vector<std::string> argumentsForEveryGroup( size_t optionCount )
+{
+   std::vector<std::string> args;
+   for ( size_t i = 0; i < optionCount; i += 100 ) {
+      args.push_back( "--option-" + std::to_string( i ) );
+      args.push_back( "1" );
+   }
+   args.push_back( "input.txt" );
+   return args;
+}
+}   // namespace
+
+// A session parses a short command line with a large synthetic definition.
+static void BM_ValidateSynthetic( benchmark::State& state )
+{
+   SyntheticOptions options( optionCount( state ) );
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout );
+   benchutil::defineSyntheticOptions( parser, options );
+
+   auto args = benchutil::syntheticArguments( optionCount( state ) );
+   auto session = parse_session( parser );
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_ValidateSynthetic )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
+
+// The defaults are assigned to most of the options and every group is
+// required.
+static void BM_ValidateDefaults( benchmark::State& state )
+{
+   SyntheticOptions options( optionCount( state ) );
+   std::stringstream strout;
+   argument_parser parser;
+   parser.config().cout( strout );
+   defineOptionsWithDefaults( parser, options );
+
+   auto args = argumentsForEveryGroup( optionCount( state ) );
+   auto session = parse_session( parser );
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      auto& res = session.parse_args( args );
+      benchmark::DoNotOptimize( static_cast<bool>( res ) );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_ValidateDefaults )->Arg( 200 )->Arg( 2000 )->Arg( 10000 );
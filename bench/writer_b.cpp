@@ -0,0 +1,79 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+// Word wrapping of long descriptions with the Writer that formats the help.
+
+#include "allocations.h"
+
+#include <argumentum/argparse.h>
+
+#include <argumentum/../../src/writer.h>
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+
+using namespace argumentum;
+using benchutil::AllocationCounter;
+
+namespace {
+// A description with @p paragraphCount paragraphs of about 60 words each.
+std::string longDescription( size_t paragraphCount )
+{
+   const std::string sentence = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed "
+                                "do eiusmod tempor incididunt ut labore et dolore magna aliqua. ";
+   std::string text;
+   for ( size_t i = 0; i < paragraphCount; ++i ) {
+      if ( i > 0 )
+         text += i % 2 ? "\n\n" : " \n \t\n  ";
+      for ( int k = 0; k < 3; ++k )
+         text += sentence;
+      text += "\n";
+   }
+   return text;
+}
+}   // namespace
+
+// The description is written as a single block with a hanging indent, like
+// the description of an option.
+static void BM_WriteDescription( benchmark::State& state )
+{
+   auto text = longDescription( static_cast<size_t>( state.range( 0 ) ) );
+   std::ostringstream strout;
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      strout.str( "" );
+      Writer writer( strout, 80 );
+      writer.setIndent( 30 );
+      writer.write( text );
+      writer.startParagraph();
+      benchmark::DoNotOptimize( strout.tellp() );
+   }
+   state.SetBytesProcessed( int64_t( state.iterations() ) * int64_t( text.size() ) );
+   allocations.report( state );
+}
+BENCHMARK( BM_WriteDescription )->Arg( 1 )->Arg( 10 )->Arg( 100 );
+
+// Many short texts, like the names and descriptions of options in the help.
+static void BM_WriteShortTexts( benchmark::State& state )
+{
+   std::ostringstream strout;
+
+   AllocationCounter allocations;
+   for ( auto _ : state ) {
+      strout.str( "" );
+      Writer writer( strout, 80 );
+      for ( int i = 0; i < state.range( 0 ); ++i ) {
+         writer.setIndent( 2 );
+         writer.write( "-o, --option-name VALUE" );
+         writer.skipToColumnOrNewLine( 30 );
+         writer.setIndent( 30 );
+         writer.write( "The description of the option." );
+         writer.startLine();
+      }
+      benchmark::DoNotOptimize( strout.tellp() );
+   }
+   allocations.report( state );
+}
+BENCHMARK( BM_WriteShortTexts )->Arg( 100 )->Arg( 2000 );
@@ -9,23 +9,35 @@
 
 #include "../../src/argdescriber_impl.h"
 #include "../../src/argparser_impl.h"
+#include "../../src/argumentlexer_impl.h"
 #include "../../src/argumentstream_impl.h"
+#include "../../src/cachingfilesystem_impl.h"
 #include "../../src/command_impl.h"
 #include "../../src/commandconfig_impl.h"
+#include "../../src/commandtrie_impl.h"
+#include "../../src/completer_impl.h"
+#include "../../src/completiontrie_impl.h"
 #include "../../src/convert_impl.h"
+#include "../../src/editindex_impl.h"
 #include "../../src/environment_impl.h"
 #include "../../src/group_impl.h"
 #include "../../src/groupconfig_impl.h"
+#include "../../src/helpcache_impl.h"
 #include "../../src/helpformatter_impl.h"
+#include "../../src/mappedfilestream_impl.h"
+#include "../../src/nameindexcache_impl.h"
 #include "../../src/option_impl.h"
 #include "../../src/optionconfig_impl.h"
 #include "../../src/optionpack_impl.h"
 #include "../../src/optionsorter_impl.h"
 #include "../../src/parameterconfig_impl.h"
+#include "../../src/parsecontext_impl.h"
 #include "../../src/parser_impl.h"
 #include "../../src/parserconfig_impl.h"
 #include "../../src/parserdefinition_impl.h"
 #include "../../src/parseresult_impl.h"
+#include "../../src/parsesession_impl.h"
+#include "../../src/quotedargumentstream_impl.h"
 #include "../../src/value_impl.h"
 #include "../../src/writer_impl.h"
 
@@ -19,10 +19,16 @@ ARGUMENTUM_INLINE ArgumentHelpResult ArgumentDescriber::describe_argument(
       const ParserDefinition& parserDef, std::string_view name ) const
 {
    bool isPositional = name.substr( 0, 1 ) != "-";
-   const auto& args = isPositional ? parserDef.mPositional : parserDef.mOptions;
-   for ( auto& pOpt : args )
-      if ( pOpt->hasName( name ) )
-         return describeOption( *pOpt );
+   if ( !isPositional ) {
+      auto pOption = parserDef.findOption( name );
+      if ( pOption )
+         return describeOption( *pOption );
+   }
+   else {
+      for ( auto& pOpt : parserDef.mPositional )
+         if ( pOpt->hasName( name ) )
+            return describeOption( *pOpt );
+   }
 
    throw std::invalid_argument( "Unknown option." );
 }
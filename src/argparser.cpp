@@ -3,23 +3,35 @@
 
 #include "argdescriber_impl.h"
 #include "argparser_impl.h"
+#include "argumentlexer_impl.h"
 #include "argumentstream_impl.h"
+#include "cachingfilesystem_impl.h"
 #include "command_impl.h"
 #include "commandconfig_impl.h"
+#include "commandtrie_impl.h"
+#include "completer_impl.h"
+#include "completiontrie_impl.h"
 #include "convert_impl.h"
+#include "editindex_impl.h"
 #include "environment_impl.h"
 #include "group_impl.h"
 #include "groupconfig_impl.h"
+#include "helpcache_impl.h"
 #include "helpformatter_impl.h"
+#include "mappedfilestream_impl.h"
+#include "nameindexcache_impl.h"
 #include "option_impl.h"
 #include "optionconfig_impl.h"
 #include "optionpack_impl.h"
 #include "optionsorter_impl.h"
 #include "parameterconfig_impl.h"
+#include "parsecontext_impl.h"
 #include "parser_impl.h"
 #include "parserconfig_impl.h"
 #include "parserdefinition_impl.h"
 #include "parseresult_impl.h"
+#include "parsesession_impl.h"
+#include "quotedargumentstream_impl.h"
 #include "value_impl.h"
 #include "writer_impl.h"
 
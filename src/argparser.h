@@ -4,6 +4,7 @@
 #pragma once
 
 #include "argumentstream.h"
+#include "cachingfilesystem.h"
 #include "commandconfig.h"
 #include "environment.h"
 #include "groupconfig.h"
@@ -12,9 +13,12 @@
 #include "optionfactory.h"
 #include "optionpack.h"
 #include "parameterconfig.h"
+#include "parsecontext.h"
 #include "parserconfig.h"
 #include "parserdefinition.h"
 #include "parseresult.h"
+#include "parsesession.h"
+#include "staticparser.h"
 
 #include <algorithm>
 #include <cassert>
@@ -25,20 +29,32 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
+#if __cplusplus >= 202002L && __has_include( <span> )
+#include <span>
+#define ARGUMENTUM_HAS_SPAN
+#endif
+
 namespace argumentum {
 
 class argument_parser
 {
+   friend class Completer;
    friend class Parser;
    friend class ParameterConfig;
+   friend class parse_session;
 
 private:
    bool mTopLevel = true;
    ParserDefinition mParserDef;
    std::unique_ptr<OptionFactory> mpOptionFactory;
 
+   // The context used by parse_args.  It uses the values of the definition.
+   ParseContext mContext;
+
 public:
    /**
     * Get a reference to the parser configuration through which the parser can
@@ -154,6 +170,36 @@ public:
    // Parse input arguments and return commands and errors in a ParseResult.
    ParseResult parse_args( const std::vector<std::string>& args, int skip_args = 0 );
 
+   // Parse input arguments and return commands and errors in a ParseResult.
+   // The arguments are not copied.
+   //
+   // This is a template so that a braced list of strings still selects the
+   // overload with std::vector<std::string>.
+   template<typename TView,
+         typename = std::enable_if_t<std::is_same_v<TView, std::string_view>>>
+   ParseResult parse_args( const std::vector<TView>& args, int skip_args = 0 )
+   {
+      auto ibegin = std::begin( args );
+      if ( skip_args > 0 )
+         ibegin += std::min<size_t>( skip_args, args.size() );
+
+      auto argStream = IteratorArgumentStream( ibegin, std::end( args ) );
+      return parseOrShowHelp( argStream, ibegin == std::end( args ) );
+   }
+
+#ifdef ARGUMENTUM_HAS_SPAN
+   // Parse input arguments and return commands and errors in a ParseResult.
+   // The arguments are not copied.
+   ParseResult parse_args( std::span<const char* const> args, int skip_args = 0 )
+   {
+      if ( skip_args > 0 )
+         args = args.subspan( std::min<size_t>( skip_args, args.size() ) );
+
+      auto argStream = ArgvArgumentStream( args.data(), args.data() + args.size() );
+      return parseOrShowHelp( argStream, args.empty() );
+   }
+#endif
+
    // Parse input arguments and return commands and errors in a ParseResult.
    ParseResult parse_args( std::vector<std::string>::const_iterator ibegin,
          std::vector<std::string>::const_iterator iend );
@@ -165,16 +211,23 @@ public:
    std::vector<ArgumentHelpResult> describe_arguments() const;
 
 private:
-   static argument_parser createSubParser();
-   void resetOptionValues();
-   void assignDefaultValues();
+   static std::shared_ptr<argument_parser> createSubParser();
+   ParseResult parseOrShowHelp( ArgumentStream& args, bool isEmpty );
+   void parseOrShowHelp( ArgumentStream& args, bool isEmpty, ParseContext& context,
+         ParseResultBuilder& result );
+   void parse( ArgumentStream& args, ParseContext& context, ParseResultBuilder& result,
+         bool helpForMissing = false );
+   void showHelpForMissingArguments( ParseResultBuilder& result );
+   void resetOptionValues( ParseContext& context );
+   void assignDefaultValues( ParseContext& context );
    void verifyDefinedOptions();
-   void validateParsedOptions( ParseResultBuilder& result );
-   void reportMissingOptions( ParseResultBuilder& result );
+   void validateParsedOptions( ParseContext& context, ParseResultBuilder& result );
+   void reportMissingOptions( const ParseContext& context, ParseResultBuilder& result );
    bool hasRequiredArguments() const;
-   void reportExclusiveViolations( ParseResultBuilder& result );
-   void reportMissingGroups( ParseResultBuilder& result );
-   void describe_errors( ParseResult& result );
+   bool hasMissingRequiredArguments( const ParseContext& context ) const;
+   void reportExclusiveViolations( ParseContext& context, ParseResultBuilder& result );
+   void reportMissingGroups( ParseContext& context, ParseResultBuilder& result );
+   void describe_errors( const ParseResult& result );
    // TODO (mmahnic): remove, moved to ParameterConfig
    OptionFactory& getOptionFactory();
 };
@@ -15,11 +15,11 @@
 
 namespace argumentum {
 
-ARGUMENTUM_INLINE argument_parser argument_parser::createSubParser()
+ARGUMENTUM_INLINE std::shared_ptr<argument_parser> argument_parser::createSubParser()
 {
-   auto parser = argument_parser{};
-   parser.mTopLevel = false;
-   return parser;
+   auto pParser = std::make_shared<argument_parser>();
+   pParser->mTopLevel = false;
+   return pParser;
 }
 
 ARGUMENTUM_INLINE ParserConfig& argument_parser::config()
@@ -48,16 +48,16 @@ ARGUMENTUM_INLINE OptionFactory& argument_parser::getOptionFactory()
 ARGUMENTUM_INLINE ParseResult argument_parser::parse_args( int argc, char** argv, int skip_args )
 {
    if ( !argv ) {
-      auto res = ParseResultBuilder{};
+      auto res = ParseResultBuilder{ getConfig().memory_resource() };
       res.addError( "argv", INVALID_ARGV );
       return res.getResult();
    }
 
-   std::vector<std::string> args;
-   for ( int i = std::max( 0, skip_args ); i < argc; ++i )
-      args.emplace_back( argv[i] );
-
-   return parse_args( std::begin( args ), std::end( args ) );
+   auto count = std::max( 0, argc );
+   auto ibegin = argv + std::min( std::max( 0, skip_args ), count );
+   auto iend = argv + count;
+   auto argStream = ArgvArgumentStream( ibegin, iend );
+   return parseOrShowHelp( argStream, ibegin == iend );
 }
 
 ARGUMENTUM_INLINE ParseResult argument_parser::parse_args(
@@ -74,50 +74,88 @@ ARGUMENTUM_INLINE ParseResult argument_parser::parse_args(
       std::vector<std::string>::const_iterator ibegin,
       std::vector<std::string>::const_iterator iend )
 {
-   if ( ibegin == iend ) {
-      verifyDefinedOptions();
-      if ( hasRequiredArguments() ) {
-         ParseResultBuilder result;
+   auto argStream = IteratorArgumentStream( ibegin, iend );
+   return parseOrShowHelp( argStream, ibegin == iend );
+}
 
-         auto config = getConfig();
-         auto pFormatter = config.help_formatter( "" );
-         auto pStream = config.output_stream();
-         assert( pFormatter && pStream );
+ARGUMENTUM_INLINE ParseResult argument_parser::parseOrShowHelp(
+      ArgumentStream& args, bool isEmpty )
+{
+   verifyDefinedOptions();
 
-         pFormatter->format( mParserDef, *pStream );
-         result.signalHelpShown();
-         result.requestExit();
+   ParseResultBuilder result{ getConfig().memory_resource() };
+   parseOrShowHelp( args, isEmpty, mContext, result );
+   return std::move( result.getResult() );
+}
 
-         return std::move( result.getResult() );
+ARGUMENTUM_INLINE void argument_parser::parseOrShowHelp(
+      ArgumentStream& args, bool isEmpty, ParseContext& context, ParseResultBuilder& result )
+{
+   if ( isEmpty && hasRequiredArguments() ) {
+      // The required options may be set by environment variables.  The help
+      // is shown if they are still missing after the environment is read.
+      if ( !mParserDef.getOptionTable().envSlots.empty() ) {
+         parse( args, context, result, true );
+         return;
       }
+
+      result.clear();
+      showHelpForMissingArguments( result );
+      return;
    }
 
-   auto argStream = IteratorArgumentStream( ibegin, iend );
-   return parse_args( argStream );
+   parse( args, context, result );
+}
+
+ARGUMENTUM_INLINE void argument_parser::showHelpForMissingArguments( ParseResultBuilder& result )
+{
+   auto& config = getConfig();
+   auto pFormatter = config.help_formatter( "" );
+   auto pStream = config.output_stream();
+   assert( pFormatter && pStream );
+
+   pFormatter->format( mParserDef, *pStream );
+   result.signalHelpShown();
+   result.requestExit();
 }
 
 ARGUMENTUM_INLINE ParseResult argument_parser::parse_args( ArgumentStream& args )
 {
    verifyDefinedOptions();
-   resetOptionValues();
 
-   ParseResultBuilder result;
-   Parser parser( mParserDef, result );
+   ParseResultBuilder result{ getConfig().memory_resource() };
+   parse( args, mContext, result );
+   return std::move( result.getResult() );
+}
+
+// The definition must be verified before parsing.
+ARGUMENTUM_INLINE void argument_parser::parse( ArgumentStream& args, ParseContext& context,
+      ParseResultBuilder& result, bool helpForMissing )
+{
+   context.prepare( mParserDef );
+   resetOptionValues( context );
+
+   Parser parser( mParserDef, context, result );
    parser.parse( args );
    if ( result.wasExitRequested() )
-      return std::move( result.getResult() );
+      return;
+
+   // The environment variables have a lower precedence than the arguments
+   // and a higher precedence than the defaults.
+   parser.parseEnvironment();
+   if ( helpForMissing && hasMissingRequiredArguments( context ) ) {
+      result.clear();
+      showHelpForMissingArguments( result );
+      return;
+   }
 
-   assignDefaultValues();
-   validateParsedOptions( result );
+   assignDefaultValues( context );
+   validateParsedOptions( context, result );
 
    if ( mTopLevel && result.hasArgumentProblems() ) {
       result.signalErrorsShown();
-      auto res = std::move( result.getResult() );
-      describe_errors( res );
-      return res;
+      describe_errors( result.peekResult() );
    }
-
-   return std::move( result.getResult() );
 }
 
 ARGUMENTUM_INLINE ArgumentHelpResult argument_parser::describe_argument(
@@ -133,24 +171,17 @@ ARGUMENTUM_INLINE std::vector<ArgumentHelpResult> argument_parser::describe_argu
    return describer.describe_arguments( mParserDef );
 }
 
-ARGUMENTUM_INLINE void argument_parser::resetOptionValues()
+ARGUMENTUM_INLINE void argument_parser::resetOptionValues( ParseContext& context )
 {
-   for ( auto& pOption : mParserDef.mOptions )
-      pOption->resetValue();
-
-   for ( auto& pOption : mParserDef.mPositional )
-      pOption->resetValue();
+   context.reset();
 }
 
-ARGUMENTUM_INLINE void argument_parser::assignDefaultValues()
+ARGUMENTUM_INLINE void argument_parser::assignDefaultValues( ParseContext& context )
 {
-   for ( auto& pOption : mParserDef.mOptions )
-      if ( !pOption->wasAssigned() && pOption->hasDefault() )
-         pOption->assignDefault();
-
-   for ( auto& pOption : mParserDef.mPositional )
-      if ( !pOption->wasAssigned() && pOption->hasDefault() )
-         pOption->assignDefault();
+   auto& table = mParserDef.getOptionTable();
+   for ( auto slot : table.defaultSlots )
+      if ( !context.wasValueAssigned( table.valueSlots[slot] ) )
+         table.options[slot]->assignDefault( context );
 }
 
 ARGUMENTUM_INLINE void argument_parser::verifyDefinedOptions()
@@ -166,79 +197,141 @@ ARGUMENTUM_INLINE void argument_parser::verifyDefinedOptions()
       }
    }
 
+   mParserDef.buildIndex();
+   mParserDef.assignSlots();
+
    // A required option can not be in an exclusive group.
-   for ( auto& pOption : mParserDef.mOptions ) {
-      if ( pOption->isRequired() ) {
-         auto pGroup = pOption->getGroup();
-         if ( pGroup && pGroup->isExclusive() )
-            throw RequiredExclusiveOption( pOption->getName(), pGroup->getName() );
+   auto& table = mParserDef.getOptionTable();
+   for ( auto slot : table.requiredSlots ) {
+      auto iGroup = table.groupIndices[slot];
+      if ( iGroup != OptionTable::noGroup && table.groups[iGroup]->isExclusive() ) {
+         auto pGroup = table.groups[iGroup];
+         throw RequiredExclusiveOption( table.options[slot]->getName(), pGroup->getName() );
       }
    }
+
+   // The help is rendered again only when the definition changed.
+   auto& config = getConfig();
+   if ( config.precompute_help()
+         && !mParserDef.getHelpCache().hasGeneration(
+               mParserDef.getGeneration(), config.help_revision() ) ) {
+      auto pFormatter = config.help_formatter( "" );
+      assert( pFormatter );
+      pFormatter->prepare( mParserDef );
+   }
 }
 
-ARGUMENTUM_INLINE void argument_parser::validateParsedOptions( ParseResultBuilder& result )
+ARGUMENTUM_INLINE void argument_parser::validateParsedOptions(
+      ParseContext& context, ParseResultBuilder& result )
 {
-   reportMissingOptions( result );
-   reportExclusiveViolations( result );
-   reportMissingGroups( result );
+   reportMissingOptions( context, result );
+   reportExclusiveViolations( context, result );
+   reportMissingGroups( context, result );
 }
 
-ARGUMENTUM_INLINE void argument_parser::reportMissingOptions( ParseResultBuilder& result )
+ARGUMENTUM_INLINE void argument_parser::reportMissingOptions(
+      const ParseContext& context, ParseResultBuilder& result )
 {
-   for ( auto& pOption : mParserDef.mOptions )
-      if ( pOption->isRequired() && !pOption->wasAssigned() )
-         result.addError( pOption->getHelpName(), MISSING_OPTION );
+   auto& table = mParserDef.getOptionTable();
+   for ( auto slot : table.requiredSlots )
+      if ( !context.wasValueAssigned( table.valueSlots[slot] ) )
+         result.addError( table.options[slot]->getHelpName(), MISSING_OPTION );
 
-   for ( auto& pOption : mParserDef.mPositional )
+   for ( size_t slot = table.firstPositional; slot < table.flags.size(); ++slot ) {
       // A positional option must have enough arguments.
-      if ( pOption->needsMoreArguments() )
+      if ( context.getOptionState( slot ).currentAssignCount < table.minArgs[slot] ) {
          // If it is optional, it may have no arguments.
-         if ( pOption->isRequired() || pOption->wasAssigned() )
-            result.addError( pOption->getHelpName(), MISSING_ARGUMENT );
+         if ( ( table.flags[slot] & OptionTable::required )
+               || context.wasValueAssigned( table.valueSlots[slot] ) )
+            result.addError( table.options[slot]->getHelpName(), MISSING_ARGUMENT );
+      }
+   }
 }
 
 ARGUMENTUM_INLINE bool argument_parser::hasRequiredArguments() const
 {
-   for ( auto& pOption : mParserDef.mOptions )
-      if ( pOption->isRequired() )
+   return mParserDef.getOptionTable().hasRequired;
+}
+
+ARGUMENTUM_INLINE bool argument_parser::hasMissingRequiredArguments(
+      const ParseContext& context ) const
+{
+   auto& table = mParserDef.getOptionTable();
+   for ( auto slot : table.requiredSlots )
+      if ( !context.wasValueAssigned( table.valueSlots[slot] ) )
          return true;
 
-   for ( auto& pOption : mParserDef.mPositional )
-      if ( pOption->isRequired() )
+   for ( size_t slot = table.firstPositional; slot < table.flags.size(); ++slot )
+      if ( ( table.flags[slot] & OptionTable::required )
+            && !context.wasValueAssigned( table.valueSlots[slot] ) )
          return true;
 
    return false;
 }
 
-ARGUMENTUM_INLINE void argument_parser::reportExclusiveViolations( ParseResultBuilder& result )
+// Only the options that were used in this parse are checked.  A violation is
+// reported with the first option of the group, in the order of definition,
+// that was used.
+ARGUMENTUM_INLINE void argument_parser::reportExclusiveViolations(
+      ParseContext& context, ParseResultBuilder& result )
 {
-   std::map<std::string, std::vector<std::string>> counts;
-   for ( auto& pOption : mParserDef.mOptions ) {
-      auto pGroup = pOption->getGroup();
-      if ( pGroup && pGroup->isExclusive() && pOption->wasAssignedThroughThisOption() )
-         counts[pGroup->getName()].push_back( pOption->getHelpName() );
+   auto& table = mParserDef.getOptionTable();
+   auto& used = context.getUsedGroups();
+   auto& violated = context.getViolatedGroups();
+   used.reset( table.groups.size() );
+   violated.reset( table.groups.size() );
+
+   bool hasViolations = false;
+   for ( auto slot : context.getTouchedOptions() ) {
+      auto iGroup = slot < table.firstPositional ? table.groupIndices[slot] : OptionTable::noGroup;
+      if ( iGroup == OptionTable::noGroup || !table.groups[iGroup]->isExclusive()
+            || context.getOptionState( slot ).totalAssignCount == 0 )
+         continue;
+      if ( !used.insert( iGroup ) ) {
+         violated.insert( iGroup );
+         hasViolations = true;
+      }
    }
 
-   for ( auto& c : counts )
-      if ( c.second.size() > 1 )
-         result.addError( c.second.front(), EXCLUSIVE_OPTION );
+   if ( !hasViolations )
+      return;
+
+   for ( uint32_t iGroup = 0; iGroup < table.groups.size(); ++iGroup ) {
+      if ( !violated.contains( iGroup ) )
+         continue;
+
+      auto first = table.firstPositional;
+      for ( auto slot : context.getTouchedOptions() )
+         if ( slot < first && table.groupIndices[slot] == iGroup
+               && context.getOptionState( slot ).totalAssignCount > 0 )
+            first = slot;
+      result.addError( table.options[first]->getHelpName(), EXCLUSIVE_OPTION );
+   }
 }
 
-ARGUMENTUM_INLINE void argument_parser::reportMissingGroups( ParseResultBuilder& result )
+// A required group is satisfied when the value of any of its options was
+// assigned, even through an option that shares the value.
+ARGUMENTUM_INLINE void argument_parser::reportMissingGroups(
+      ParseContext& context, ParseResultBuilder& result )
 {
-   std::map<std::string, int> counts;
-   for ( auto& pOption : mParserDef.mOptions ) {
-      auto pGroup = pOption->getGroup();
-      if ( pGroup && pGroup->isRequired() )
-         counts[pGroup->getName()] += pOption->wasAssigned() ? 1 : 0;
+   auto& table = mParserDef.getOptionTable();
+   auto& assigned = context.getUsedGroups();
+   assigned.reset( table.groups.size() );
+
+   for ( auto valueSlot : context.getTouchedValues() ) {
+      auto begin = table.valueGroupStarts[valueSlot];
+      auto end = table.valueGroupStarts[valueSlot + 1];
+      if ( begin != end && context.wasValueAssigned( valueSlot ) )
+         for ( auto i = begin; i < end; ++i )
+            assigned.insert( table.valueGroups[i] );
    }
 
-   for ( auto& c : counts )
-      if ( c.second < 1 )
-         result.addError( c.first, MISSING_OPTION_GROUP );
+   for ( uint32_t iGroup = 0; iGroup < table.groups.size(); ++iGroup )
+      if ( table.groups[iGroup]->isRequired() && !assigned.contains( iGroup ) )
+         result.addError( table.groups[iGroup]->getName(), MISSING_OPTION_GROUP );
 }
 
-ARGUMENTUM_INLINE void argument_parser::describe_errors( ParseResult& result )
+ARGUMENTUM_INLINE void argument_parser::describe_errors( const ParseResult& result )
 {
    auto pStream = mParserDef.getConfig().output_stream();
    assert( pStream );
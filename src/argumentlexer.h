@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace argumentum {
+
+enum class EArgumentType {
+   // A free argument is not an option or an option value.
+   freeArgument,
+
+   // Include the contents of a file as options.
+   include,
+
+   // Treat the rest of the arguments as free argumetns.
+   endOfOptions,
+
+   // An option with a long name, currently identified with '--' prefix.
+   longOption,
+
+   // An option with a sinble character name, currently identified with '-' prefix.
+   shortOption,
+
+   // Short options can be combined in a single argument prefixed with '-'.
+   multiOption,
+
+   // A value of an option that accepts one or more valuers.
+   optionValue,
+
+   // The name of a command.
+   commandName
+};
+
+// The lexical properties of an input argument.
+struct ArgumentToken
+{
+   std::string_view text;
+
+   // The type of the argument derived from its text alone.  One of
+   // freeArgument, include, endOfOptions, longOption, shortOption and
+   // multiOption.  The parser refines it with the state of parsing.
+   EArgumentType type = EArgumentType::freeArgument;
+
+   // The text after the leading '-' of a short option looks like a number.
+   bool isNumber = false;
+
+   // The positions of the first '=' and the first ',' in an option.
+   size_t eqpos = std::string_view::npos;
+   size_t commapos = std::string_view::npos;
+};
+
+// Splits input arguments into tokens without using regular expressions.  The
+// properties of an argument are derived in a single pass over its characters.
+class ArgumentLexer
+{
+public:
+   ArgumentToken lex( std::string_view arg ) const;
+
+   // Returns true if @p text is a binary (0b), octal (0o), decimal (0d or no
+   // prefix) or hexadecimal (0x) number.  Decimal and hexadecimal numbers may
+   // have a fraction and an exponent (e or p).
+   static bool isNumberLike( std::string_view text );
+};
+
+// Splits the comma delimited list of forwarded arguments that follows the
+// name of a forwarded option.  A double comma is an escaped comma that is part
+// of an argument.  The first comma of the list is always escaped.  Empty
+// arguments are skipped.
+class ForwardedArgumentSplitter
+{
+   std::string_view mArgs;
+   size_t mPos = 0;
+   std::string mUnescaped;
+
+public:
+   ForwardedArgumentSplitter( std::string_view args );
+
+   // Returns the next argument or nullopt at the end of the list.  The
+   // returned view points into the original list unless the argument
+   // contains escaped commas.  In that case it is valid until the next call.
+   std::optional<std::string_view> next();
+
+   // Returns the number of arguments that next() will still return.
+   size_t countRemaining() const;
+
+private:
+   // Finds the next raw argument, before commas are unescaped.
+   bool advance( std::string_view& piece, bool& hasEscapes );
+   std::string_view unescape( std::string_view piece, bool startsWithComma );
+};
+
+}   // namespace argumentum
@@ -0,0 +1,429 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "argumentlexer.h"
+
+#include <array>
+#include <cstdint>
+
+namespace argumentum {
+
+namespace lexer {
+
+// Character classes of the number grammar.
+enum ECharClass : uint8_t {
+   cZero,       // 0
+   cOne,        // 1
+   cOctal,      // 2-7
+   cDecimal,    // 8-9
+   cDot,        // .
+   cSign,       // + -
+   cLowerB,     // b: binary prefix, hex digit
+   cLowerD,     // d: decimal prefix, hex digit
+   cExponent,   // e E: decimal exponent, hex digit
+   cHexAlpha,   // the remaining hex digits a c f A B C D F
+   cLowerO,     // o: octal prefix
+   cLowerX,     // x: hexadecimal prefix
+   cHexExp,     // p P: hexadecimal exponent
+   cOther,
+   charClassCount
+};
+
+// States of the automaton that recognizes numbers.  The grammar is equivalent
+// to the regular expression:
+//
+//    0b[01]+
+//    | 0o[0-7]+
+//    | (0d)?[0-9]*\.?[0-9]+([eE][-+]?[0-9]+)?
+//    | 0x[0-9a-fA-F]*\.?[0-9a-fA-F]+([pP][-+]?[0-9a-fA-F]+)?
+enum EState : uint8_t {
+   sStart,
+   sZero,
+   sBinPrefix,
+   sBin,
+   sOctPrefix,
+   sOct,
+   sDecPrefix,
+   sDecInt,
+   sDecDot,
+   sDecFrac,
+   sDecExpStart,
+   sDecExpSign,
+   sDecExp,
+   sHexPrefix,
+   sHexInt,
+   sHexDot,
+   sHexFrac,
+   sHexExpStart,
+   sHexExpSign,
+   sHexExp,
+   sReject,
+   stateCount
+};
+
+constexpr ECharClass classify( unsigned char ch )
+{
+   switch ( ch ) {
+      case '0':
+         return cZero;
+      case '1':
+         return cOne;
+      case '8':
+      case '9':
+         return cDecimal;
+      case '.':
+         return cDot;
+      case '+':
+      case '-':
+         return cSign;
+      case 'b':
+         return cLowerB;
+      case 'd':
+         return cLowerD;
+      case 'e':
+      case 'E':
+         return cExponent;
+      case 'o':
+         return cLowerO;
+      case 'x':
+         return cLowerX;
+      case 'p':
+      case 'P':
+         return cHexExp;
+   }
+
+   if ( ch >= '2' && ch <= '7' )
+      return cOctal;
+   if ( ( ch >= 'a' && ch <= 'f' ) || ( ch >= 'A' && ch <= 'F' ) )
+      return cHexAlpha;
+
+   return cOther;
+}
+
+constexpr bool isBin( ECharClass cls )
+{
+   return cls == cZero || cls == cOne;
+}
+
+constexpr bool isOct( ECharClass cls )
+{
+   return isBin( cls ) || cls == cOctal;
+}
+
+constexpr bool isDec( ECharClass cls )
+{
+   return isOct( cls ) || cls == cDecimal;
+}
+
+constexpr bool isHex( ECharClass cls )
+{
+   return isDec( cls ) || cls == cLowerB || cls == cLowerD || cls == cExponent
+         || cls == cHexAlpha;
+}
+
+constexpr EState next( EState state, ECharClass cls )
+{
+   switch ( state ) {
+      case sStart:
+         if ( cls == cZero )
+            return sZero;
+         if ( isDec( cls ) )
+            return sDecInt;
+         if ( cls == cDot )
+            return sDecDot;
+         break;
+      case sZero:
+         if ( cls == cLowerB )
+            return sBinPrefix;
+         if ( cls == cLowerO )
+            return sOctPrefix;
+         if ( cls == cLowerD )
+            return sDecPrefix;
+         if ( cls == cLowerX )
+            return sHexPrefix;
+         return next( sDecInt, cls );
+      case sBinPrefix:
+      case sBin:
+         if ( isBin( cls ) )
+            return sBin;
+         break;
+      case sOctPrefix:
+      case sOct:
+         if ( isOct( cls ) )
+            return sOct;
+         break;
+      case sDecPrefix:
+         if ( isDec( cls ) )
+            return sDecInt;
+         if ( cls == cDot )
+            return sDecDot;
+         break;
+      case sDecInt:
+         if ( isDec( cls ) )
+            return sDecInt;
+         if ( cls == cDot )
+            return sDecDot;
+         if ( cls == cExponent )
+            return sDecExpStart;
+         break;
+      case sDecDot:
+         if ( isDec( cls ) )
+            return sDecFrac;
+         break;
+      case sDecFrac:
+         if ( isDec( cls ) )
+            return sDecFrac;
+         if ( cls == cExponent )
+            return sDecExpStart;
+         break;
+      case sDecExpStart:
+         if ( cls == cSign )
+            return sDecExpSign;
+         return next( sDecExpSign, cls );
+      case sDecExpSign:
+      case sDecExp:
+         if ( isDec( cls ) )
+            return sDecExp;
+         break;
+      case sHexPrefix:
+         if ( isHex( cls ) )
+            return sHexInt;
+         if ( cls == cDot )
+            return sHexDot;
+         break;
+      case sHexInt:
+         if ( isHex( cls ) )
+            return sHexInt;
+         if ( cls == cDot )
+            return sHexDot;
+         if ( cls == cHexExp )
+            return sHexExpStart;
+         break;
+      case sHexDot:
+         if ( isHex( cls ) )
+            return sHexFrac;
+         break;
+      case sHexFrac:
+         if ( isHex( cls ) )
+            return sHexFrac;
+         if ( cls == cHexExp )
+            return sHexExpStart;
+         break;
+      case sHexExpStart:
+         if ( cls == cSign )
+            return sHexExpSign;
+         return next( sHexExpSign, cls );
+      case sHexExpSign:
+      case sHexExp:
+         if ( isHex( cls ) )
+            return sHexExp;
+         break;
+      case sReject:
+      case stateCount:
+         break;
+   }
+
+   return sReject;
+}
+
+constexpr bool isAccepting( EState state )
+{
+   switch ( state ) {
+      case sZero:
+      case sBin:
+      case sOct:
+      case sDecInt:
+      case sDecFrac:
+      case sDecExp:
+      case sHexInt:
+      case sHexFrac:
+      case sHexExp:
+         return true;
+      default:
+         return false;
+   }
+}
+
+constexpr std::array<ECharClass, 256> makeCharClassTable()
+{
+   std::array<ECharClass, 256> table{};
+   for ( unsigned ch = 0; ch < table.size(); ++ch )
+      table[ch] = classify( static_cast<unsigned char>( ch ) );
+   return table;
+}
+
+constexpr std::array<std::array<EState, charClassCount>, stateCount> makeTransitionTable()
+{
+   std::array<std::array<EState, charClassCount>, stateCount> table{};
+   for ( unsigned s = 0; s < stateCount; ++s )
+      for ( unsigned c = 0; c < charClassCount; ++c )
+         table[s][c] = next( static_cast<EState>( s ), static_cast<ECharClass>( c ) );
+   return table;
+}
+
+inline constexpr auto charClassTable = makeCharClassTable();
+inline constexpr auto transitionTable = makeTransitionTable();
+
+inline EState advance( EState state, char ch )
+{
+   return transitionTable[state][charClassTable[static_cast<unsigned char>( ch )]];
+}
+
+}   // namespace lexer
+
+ARGUMENTUM_INLINE ArgumentToken ArgumentLexer::lex( std::string_view arg ) const
+{
+   ArgumentToken token;
+   token.text = arg;
+
+   if ( arg.empty() )
+      return token;
+
+   if ( arg[0] == '@' ) {
+      token.type = EArgumentType::include;
+      return token;
+   }
+
+   // A single dash is a free argument.
+   if ( arg[0] != '-' || arg.size() < 2 )
+      return token;
+
+   auto isLong = arg[1] == '-';
+   if ( isLong && arg.size() == 2 ) {
+      token.type = EArgumentType::endOfOptions;
+      return token;
+   }
+
+   // Long options are never numbers so the automaton starts in the rejected
+   // state for them.
+   auto state = isLong ? lexer::sReject : lexer::sStart;
+   for ( size_t i = 1; i < arg.size(); ++i ) {
+      auto ch = arg[i];
+      if ( ch == '=' ) {
+         if ( token.eqpos == std::string_view::npos )
+            token.eqpos = i;
+      }
+      else if ( ch == ',' ) {
+         if ( token.commapos == std::string_view::npos )
+            token.commapos = i;
+      }
+      state = lexer::advance( state, ch );
+   }
+
+   token.isNumber = lexer::isAccepting( state );
+   if ( isLong )
+      token.type = EArgumentType::longOption;
+   else
+      token.type = arg.size() == 2 ? EArgumentType::shortOption : EArgumentType::multiOption;
+
+   return token;
+}
+
+ARGUMENTUM_INLINE bool ArgumentLexer::isNumberLike( std::string_view text )
+{
+   auto state = lexer::sStart;
+   for ( auto ch : text ) {
+      state = lexer::advance( state, ch );
+      if ( state == lexer::sReject )
+         return false;
+   }
+
+   return lexer::isAccepting( state );
+}
+
+ARGUMENTUM_INLINE ForwardedArgumentSplitter::ForwardedArgumentSplitter( std::string_view args )
+   : mArgs( args )
+{}
+
+ARGUMENTUM_INLINE std::optional<std::string_view> ForwardedArgumentSplitter::next()
+{
+   std::string_view piece;
+   bool hasEscapes = false;
+   while ( true ) {
+      auto start = mPos;
+      if ( !advance( piece, hasEscapes ) )
+         return {};
+      if ( piece.empty() )
+         continue;
+      if ( !hasEscapes )
+         return piece;
+      return unescape( piece, start == 0 && piece[0] == ',' );
+   }
+}
+
+ARGUMENTUM_INLINE size_t ForwardedArgumentSplitter::countRemaining() const
+{
+   auto splitter = ForwardedArgumentSplitter( mArgs );
+   splitter.mPos = mPos;
+
+   size_t count = 0;
+   std::string_view piece;
+   bool hasEscapes = false;
+   while ( splitter.advance( piece, hasEscapes ) )
+      if ( !piece.empty() )
+         ++count;
+
+   return count;
+}
+
+ARGUMENTUM_INLINE bool ForwardedArgumentSplitter::advance(
+      std::string_view& piece, bool& hasEscapes )
+{
+   if ( mPos >= mArgs.size() )
+      return false;
+
+   auto start = mPos;
+   auto end = start;
+   hasEscapes = false;
+   if ( start == 0 && mArgs[0] == ',' ) {
+      hasEscapes = true;
+      ++end;
+   }
+
+   while ( true ) {
+      end = mArgs.find( ',', end );
+      if ( end == std::string_view::npos ) {
+         end = mArgs.size();
+         break;
+      }
+      if ( end + 1 < mArgs.size() && mArgs[end + 1] == ',' ) {
+         hasEscapes = true;
+         end += 2;
+         continue;
+      }
+      break;
+   }
+
+   piece = mArgs.substr( start, end - start );
+   mPos = end + 1;
+   return true;
+}
+
+ARGUMENTUM_INLINE std::string_view ForwardedArgumentSplitter::unescape(
+      std::string_view piece, bool startsWithComma )
+{
+   mUnescaped.clear();
+   size_t pos = 0;
+   if ( startsWithComma ) {
+      mUnescaped.push_back( ',' );
+      pos = 1;
+   }
+
+   while ( pos < piece.size() ) {
+      auto comma = piece.find( ',', pos );
+      if ( comma == std::string_view::npos ) {
+         mUnescaped.append( piece.substr( pos ) );
+         break;
+      }
+
+      // Commas inside a piece always come in pairs.
+      mUnescaped.append( piece.substr( pos, comma + 1 - pos ) );
+      pos = comma + 2;
+   }
+
+   return mUnescaped;
+}
+
+}   // namespace argumentum
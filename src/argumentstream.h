@@ -68,6 +68,16 @@ public:
    }
 };
 
+// An implementation of ArgumentStream that reads arguments directly from an
+// array of C strings like argv.  The arguments are not copied.
+class ArgvArgumentStream : public IteratorArgumentStream<const char* const*>
+{
+public:
+   ArgvArgumentStream( const char* const* begin, const char* const* end )
+      : IteratorArgumentStream( begin, end )
+   {}
+};
+
 // An implementation of ArgumentStream that reads characters from an istream and
 // merges them into string arguments.
 //
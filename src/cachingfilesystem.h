@@ -0,0 +1,68 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "filesystem.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace argumentum {
+
+/**
+ * A filesystem that keeps the arguments of the files opened through another
+ * filesystem.  When a file is opened again, only its stamp is checked and the
+ * arguments are read from the cache if the file did not change.  Files
+ * without a stamp are not cached.
+ *
+ * The cache can be shared between parsers and between threads.
+ */
+class CachingFilesystem : public Filesystem
+{
+public:
+   struct Stats
+   {
+      size_t hits = 0;
+      size_t misses = 0;
+   };
+
+private:
+   // The arguments of a file are stored in a single buffer.
+   struct Entry
+   {
+      FileStamp stamp;
+      std::string text;
+      std::vector<std::pair<size_t, size_t>> args;
+   };
+
+   class CachedArgumentStream;
+
+   std::shared_ptr<Filesystem> mpFilesystem;
+   mutable std::mutex mMutex;
+   std::unordered_map<std::string, std::shared_ptr<const Entry>> mEntries;
+   Stats mStats;
+
+public:
+   // Cache the files opened through @p pFilesystem or through the default
+   // filesystem if it is not set.
+   explicit CachingFilesystem( std::shared_ptr<Filesystem> pFilesystem = nullptr );
+
+   std::unique_ptr<ArgumentStream> open( const std::string& filename ) override;
+   std::optional<FileStamp> stamp( const std::string& filename ) override;
+
+   // The number of opened files that were found in the cache and the number
+   // of files that were read.
+   Stats stats() const;
+
+   void clear();
+
+private:
+   std::shared_ptr<const Entry> read( const std::string& filename, const FileStamp& stamp );
+};
+
+}   // namespace argumentum
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "cachingfilesystem.h"
+
+namespace argumentum {
+
+class CachingFilesystem::CachedArgumentStream : public ArgumentStream
+{
+   // The entry is kept alive while the stream is used even if it is replaced
+   // in the cache.
+   std::shared_ptr<const Entry> mpEntry;
+   size_t mCurrent = 0;
+
+public:
+   CachedArgumentStream( std::shared_ptr<const Entry> pEntry )
+      : mpEntry( std::move( pEntry ) )
+   {}
+
+   std::optional<std::string_view> next() override
+   {
+      if ( mCurrent >= mpEntry->args.size() )
+         return {};
+
+      return getArg( mCurrent++ );
+   }
+
+   void peek( std::function<EPeekResult( std::string_view )> fnPeek ) override
+   {
+      if ( !fnPeek )
+         return;
+
+      for ( auto i = mCurrent; i < mpEntry->args.size(); ++i )
+         if ( fnPeek( getArg( i ) ) == peekDone )
+            break;
+   }
+
+private:
+   std::string_view getArg( size_t index ) const
+   {
+      auto [start, length] = mpEntry->args[index];
+      return std::string_view( mpEntry->text ).substr( start, length );
+   }
+};
+
+ARGUMENTUM_INLINE CachingFilesystem::CachingFilesystem( std::shared_ptr<Filesystem> pFilesystem )
+   : mpFilesystem( pFilesystem ? std::move( pFilesystem ) : std::make_shared<DefaultFilesystem>() )
+{}
+
+ARGUMENTUM_INLINE std::unique_ptr<ArgumentStream> CachingFilesystem::open(
+      const std::string& filename )
+{
+   auto stamp = mpFilesystem->stamp( filename );
+   if ( !stamp )
+      return mpFilesystem->open( filename );
+
+   {
+      std::lock_guard<std::mutex> lock( mMutex );
+      auto it = mEntries.find( filename );
+      if ( it != mEntries.end() && it->second->stamp == *stamp ) {
+         ++mStats.hits;
+         return std::make_unique<CachedArgumentStream>( it->second );
+      }
+   }
+
+   // The file is read without holding the lock.  If two threads read the
+   // same file, the last one replaces the entry.
+   auto pEntry = read( filename, *stamp );
+   if ( !pEntry )
+      return nullptr;
+
+   std::lock_guard<std::mutex> lock( mMutex );
+   ++mStats.misses;
+   mEntries[filename] = pEntry;
+   return std::make_unique<CachedArgumentStream>( pEntry );
+}
+
+ARGUMENTUM_INLINE std::optional<FileStamp> CachingFilesystem::stamp( const std::string& filename )
+{
+   return mpFilesystem->stamp( filename );
+}
+
+ARGUMENTUM_INLINE CachingFilesystem::Stats CachingFilesystem::stats() const
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   return mStats;
+}
+
+ARGUMENTUM_INLINE void CachingFilesystem::clear()
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   mEntries.clear();
+   mStats = Stats{};
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<const CachingFilesystem::Entry> CachingFilesystem::read(
+      const std::string& filename, const FileStamp& stamp )
+{
+   auto pStream = mpFilesystem->open( filename );
+   if ( !pStream )
+      return nullptr;
+
+   auto pEntry = std::make_shared<Entry>();
+   pEntry->stamp = stamp;
+   for ( auto arg = pStream->next(); arg; arg = pStream->next() ) {
+      pEntry->args.emplace_back( pEntry->text.size(), arg->size() );
+      pEntry->text.append( *arg );
+   }
+
+   return pEntry;
+}
+
+}   // namespace argumentum
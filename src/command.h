@@ -13,10 +13,14 @@
 namespace argumentum {
 
 class CommandOptions;
+class ParseContext;
+class argument_parser;
 
 // An internal definition of a command.
 class Command
 {
+   friend class ParseContext;
+
 public:
    using options_factory_t =
          std::function<std::shared_ptr<CommandOptions>( std::string_view name )>;
@@ -27,16 +31,31 @@ private:
    options_factory_t mFactory;
    std::string mHelp;
 
+   // The parser for mpOptions.  It is built when the command is selected for
+   // the first time and reused by later parses.
+   std::shared_ptr<argument_parser> mpParser;
+
+   // Incremented when the factory is replaced so that the parsers cached in
+   // parse contexts are rebuilt.
+   unsigned mFactoryVersion = 0;
+
 public:
    Command( std::string_view name, options_factory_t factory );
    Command( std::string_view name, std::shared_ptr<CommandOptions> pOptions );
    void setHelp( std::string_view help );
+
+   // Replace the factory of the options.  The cached options and their parser
+   // are dropped.
+   void setFactory( options_factory_t factory );
    const std::string& getName() const;
    bool hasName( std::string_view name ) const;
    bool hasFactory() const;
    bool hasOptions() const;
    const std::string& getHelp() const;
    std::shared_ptr<CommandOptions> getOptions();
+
+   // Create new options with the factory of the command.
+   std::shared_ptr<CommandOptions> createOptions() const;
 };
 
 }   // namespace argumentum
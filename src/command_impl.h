@@ -24,6 +24,14 @@ ARGUMENTUM_INLINE void Command::setHelp( std::string_view help )
    mHelp = help;
 }
 
+ARGUMENTUM_INLINE void Command::setFactory( options_factory_t factory )
+{
+   mFactory = std::move( factory );
+   mpOptions = nullptr;
+   mpParser = nullptr;
+   ++mFactoryVersion;
+}
+
 ARGUMENTUM_INLINE const std::string& Command::getName() const
 {
    return mName;
@@ -51,15 +59,22 @@ ARGUMENTUM_INLINE const std::string& Command::getHelp() const
 
 ARGUMENTUM_INLINE std::shared_ptr<CommandOptions> Command::getOptions()
 {
-   if ( !mpOptions ) {
-      if ( !mFactory )
-         throw MissingCommandOptions( mName );
-
-      mpOptions = mFactory( mName );
-      if ( !mpOptions )
-         throw MissingCommandOptions( mName );
-   }
+   if ( !mpOptions )
+      mpOptions = createOptions();
+
    return mpOptions;
 }
 
+ARGUMENTUM_INLINE std::shared_ptr<CommandOptions> Command::createOptions() const
+{
+   if ( !mFactory )
+      throw MissingCommandOptions( mName );
+
+   auto pOptions = mFactory( mName );
+   if ( !pOptions )
+      throw MissingCommandOptions( mName );
+
+   return pOptions;
+}
+
 }   // namespace argumentum
@@ -3,24 +3,34 @@
 
 #pragma once
 
+#include "command.h"
+
 #include <memory>
 #include <string_view>
 
 namespace argumentum {
 
-class Command;
+class ParserDefinition;
 
 class CommandConfig
 {
    std::shared_ptr<Command> mpCommand;
 
+   // The definition that holds the command.  It is notified when the command
+   // changes.
+   ParserDefinition* mpParserDef = nullptr;
+
 public:
    CommandConfig( const std::shared_ptr<Command>& pCommand );
+   CommandConfig( const std::shared_ptr<Command>& pCommand, ParserDefinition& parserDef );
 
    // Define the description of the command that will be displayed in the
    // generated help.
    CommandConfig& help( std::string_view help );
 
+   // Replace the factory that creates the options of the command.
+   CommandConfig& factory( Command::options_factory_t factory );
+
 private:
    Command& getCommand();
 };
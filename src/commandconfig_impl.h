@@ -6,6 +6,7 @@
 #include "commandconfig.h"
 
 #include "command.h"
+#include "parserdefinition.h"
 
 namespace argumentum {
 
@@ -17,11 +18,26 @@ ARGUMENTUM_INLINE CommandConfig::CommandConfig( const std::shared_ptr<Command>&
       throw std::invalid_argument( "CommandConfig requires a command." );
 }
 
+ARGUMENTUM_INLINE CommandConfig::CommandConfig(
+      const std::shared_ptr<Command>& pCommand, ParserDefinition& parserDef )
+   : CommandConfig( pCommand )
+{
+   mpParserDef = &parserDef;
+}
+
 // Define the description of the command that will be displayed in the
 // generated help.
 ARGUMENTUM_INLINE CommandConfig& CommandConfig::help( std::string_view help )
 {
    getCommand().setHelp( help );
+   if ( mpParserDef )
+      mpParserDef->markChanged();
+   return *this;
+}
+
+ARGUMENTUM_INLINE CommandConfig& CommandConfig::factory( Command::options_factory_t factory )
+{
+   getCommand().setFactory( std::move( factory ) );
    return *this;
 }
 
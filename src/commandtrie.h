@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace argumentum {
+
+class Command;
+
+/**
+ * A trie of command names.  The nodes and the edges are stored in flat
+ * arrays.  The edges of a node are contiguous and sorted by their characters
+ * so a name is found in O(length) steps.
+ */
+class CommandTrie
+{
+   struct Node
+   {
+      uint32_t firstEdge = 0;
+      uint32_t edgeCount = 0;
+
+      // The index of the command that ends in this node or -1.
+      int32_t command = -1;
+
+      // The index of the only command in the subtree of this node, -1 if
+      // there are none and ambiguous if there are more.
+      int32_t onlyCommand = -1;
+   };
+
+   struct Edge
+   {
+      char label;
+      uint32_t target;
+   };
+
+   static constexpr int32_t ambiguous = -2;
+
+   std::vector<Node> mNodes;
+   std::vector<Edge> mEdges;
+
+public:
+   void build( const std::vector<std::shared_ptr<Command>>& commands );
+   void clear();
+
+   // Returns the index of the command named @p name or -1.
+   int find( std::string_view name ) const;
+
+   // Returns the index of the command named @p prefix or of the only command
+   // whose name starts with @p prefix.  Returns -1 if there is no such command
+   // or if the prefix is ambiguous.
+   int findByPrefix( std::string_view prefix ) const;
+
+private:
+   const Node* walk( std::string_view text ) const;
+};
+
+}   // namespace argumentum
@@ -0,0 +1,116 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "commandtrie.h"
+
+#include "command.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE void CommandTrie::build( const std::vector<std::shared_ptr<Command>>& commands )
+{
+   clear();
+   if ( commands.empty() )
+      return;
+
+   // Build the trie with a list of children for every node, then move the
+   // children into the flat array of edges.  Children are always created
+   // after their parents.
+   std::vector<std::vector<std::pair<char, uint32_t>>> children( 1 );
+   mNodes.resize( 1 );
+   for ( size_t i = 0; i < commands.size(); ++i ) {
+      uint32_t node = 0;
+      for ( auto ch : commands[i]->getName() ) {
+         auto& edges = children[node];
+         auto it = std::find_if(
+               edges.begin(), edges.end(), [ch]( const auto& edge ) { return edge.first == ch; } );
+         if ( it != edges.end() )
+            node = it->second;
+         else {
+            auto child = static_cast<uint32_t>( mNodes.size() );
+            edges.emplace_back( ch, child );
+            mNodes.emplace_back();
+            children.emplace_back();
+            node = child;
+         }
+      }
+
+      // The first command with a name wins, the same as in a linear search.
+      if ( mNodes[node].command < 0 )
+         mNodes[node].command = static_cast<int32_t>( i );
+   }
+
+   mEdges.reserve( mNodes.size() - 1 );
+   for ( size_t i = 0; i < mNodes.size(); ++i ) {
+      auto& edges = children[i];
+      std::sort( edges.begin(), edges.end() );
+      mNodes[i].firstEdge = static_cast<uint32_t>( mEdges.size() );
+      mNodes[i].edgeCount = static_cast<uint32_t>( edges.size() );
+      for ( auto& edge : edges )
+         mEdges.push_back( { edge.first, edge.second } );
+   }
+
+   // Visit the children before their parents to find the subtrees with a
+   // single command.
+   for ( auto i = mNodes.size(); i-- > 0; ) {
+      auto& node = mNodes[i];
+      auto only = node.command;
+      auto iedge = mEdges.begin() + node.firstEdge;
+      for ( auto iend = iedge + node.edgeCount; iedge != iend && only != ambiguous; ++iedge ) {
+         auto childOnly = mNodes[iedge->target].onlyCommand;
+         if ( childOnly == -1 )
+            continue;
+         only = only == -1 ? childOnly : ambiguous;
+      }
+      node.onlyCommand = only;
+   }
+}
+
+ARGUMENTUM_INLINE void CommandTrie::clear()
+{
+   mNodes.clear();
+   mEdges.clear();
+}
+
+ARGUMENTUM_INLINE int CommandTrie::find( std::string_view name ) const
+{
+   auto pNode = walk( name );
+   return pNode ? pNode->command : -1;
+}
+
+ARGUMENTUM_INLINE int CommandTrie::findByPrefix( std::string_view prefix ) const
+{
+   auto pNode = prefix.empty() ? nullptr : walk( prefix );
+   if ( !pNode )
+      return -1;
+   if ( pNode->command >= 0 )
+      return pNode->command;
+
+   return pNode->onlyCommand >= 0 ? pNode->onlyCommand : -1;
+}
+
+ARGUMENTUM_INLINE auto CommandTrie::walk( std::string_view text ) const -> const Node*
+{
+   if ( mNodes.empty() )
+      return nullptr;
+
+   const Node* pNode = &mNodes[0];
+   for ( auto ch : text ) {
+      auto ibegin = mEdges.begin() + pNode->firstEdge;
+      auto iend = ibegin + pNode->edgeCount;
+      auto it = std::lower_bound(
+            ibegin, iend, ch, []( const Edge& edge, char label ) { return edge.label < label; } );
+      if ( it == iend || it->label != ch )
+         return nullptr;
+      pNode = &mNodes[it->target];
+   }
+
+   return pNode;
+}
+
+}   // namespace argumentum
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argumentum {
+
+class Command;
+class Option;
+class ParseContext;
+class ParserDefinition;
+struct ArgumentToken;
+
+/**
+ * Completes the last word of a partial command line with the names of options
+ * and commands and with the choices of option values.  The preceding words
+ * are followed like in Parser: they select the commands and the option that
+ * receives the completed word.  The values of the options are not converted.
+ *
+ * A completion script lists the candidates of the program and of all its
+ * commands so that the shell does not need to start the program.
+ */
+class Completer
+{
+public:
+   enum EShell { plain, bash, zsh, fish };
+
+private:
+   // A command in a completion script.  The commands of the scope are listed
+   // with the indices of their scopes.
+   struct ScriptScope
+   {
+      const ParserDefinition* pParserDef;
+      ParseContext* pContext;
+      unsigned depth;
+      std::vector<std::pair<std::string_view, size_t>> commands;
+   };
+
+   // The nesting of commands in a script is limited in case the options of
+   // a command define the same command again.
+   static constexpr unsigned maxScriptDepth = 16;
+
+   const ParserDefinition& mParserDef;
+   ParseContext& mContext;
+   EShell mShell = plain;
+   std::string mOutput;
+
+   // The definition of the command that the completed word belongs to.
+   const ParserDefinition* mpParserDef;
+   ParseContext* mpContext;
+
+   // The state after the words that precede the completed word.
+   const Option* mpActiveOption = nullptr;
+   int mActiveCount = 0;
+   size_t mPosition = 0;
+   int mPositionCount = 0;
+   bool mIgnoreOptions = false;
+
+   std::vector<ScriptScope> mScopes;
+
+public:
+   Completer( const ParserDefinition& parserDef, ParseContext& context );
+
+   // Returns plain if @p name is not the name of a supported shell.
+   static EShell findShell( std::string_view name );
+
+   /**
+    * Write the candidates for the last of @p words to @p stream, one per
+    * line.  The output for zsh and fish includes the descriptions of the
+    * options and the commands in the formats of _describe and complete.
+    */
+   void complete( std::string_view shell, const std::vector<std::string_view>& words,
+         std::ostream& stream );
+
+   // Write a completion script for @p shell.  Nothing is written if the shell
+   // is not supported or if the name of the program is not configured.
+   void writeScript( std::string_view shell, std::ostream& stream );
+
+private:
+   void follow( std::string_view word );
+   void startOption( std::string_view name, bool hasValue );
+   void startOptions( const ArgumentToken& token );
+   void addFreeArgument();
+   void enterCommand( Command& command );
+   bool acceptsValue() const;
+   const Option* findCurrentPositional() const;
+
+   void addCandidates( std::string_view word );
+   void addNames( std::string_view prefix, bool options );
+   void addChoices( const Option& option, std::string_view prefix, std::string_view lead );
+   void addCandidate( std::string_view name, std::string_view description );
+
+   void collectScopes();
+   void writeShScript();
+   void writeFishScript();
+   std::vector<std::string> getOptionCandidates( const ParserDefinition& parserDef ) const;
+   std::vector<std::string> getArgumentCandidates( const ParserDefinition& parserDef ) const;
+   std::string formatCandidate( std::string_view name, std::string_view description ) const;
+   void writeWordList( const std::vector<std::string>& words, std::string_view indent );
+   void writeShCommandCases( std::string_view indent );
+   std::string quote( std::string_view text ) const;
+   std::string_view getProgramName() const;
+   std::string getFunctionName() const;
+   static std::string getScopeKey( size_t scope, std::string_view word );
+   static std::string_view getFirstLine( std::string_view text );
+};
+
+}   // namespace argumentum
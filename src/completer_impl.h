@@ -0,0 +1,647 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "completer.h"
+
+#include "argparser.h"
+#include "argumentlexer.h"
+#include "command.h"
+#include "notifier.h"
+#include "option.h"
+#include "parsecontext.h"
+#include "parser.h"
+#include "parserdefinition.h"
+
+#include <cctype>
+#include <tuple>
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE Completer::Completer( const ParserDefinition& parserDef, ParseContext& context )
+   : mParserDef( parserDef )
+   , mContext( context )
+   , mpParserDef( &parserDef )
+   , mpContext( &context )
+{}
+
+ARGUMENTUM_INLINE auto Completer::findShell( std::string_view name ) -> EShell
+{
+   if ( name == "bash" )
+      return bash;
+   if ( name == "zsh" )
+      return zsh;
+   if ( name == "fish" )
+      return fish;
+   return plain;
+}
+
+ARGUMENTUM_INLINE void Completer::complete(
+      std::string_view shell, const std::vector<std::string_view>& words, std::ostream& stream )
+{
+   mShell = findShell( shell );
+   mOutput.clear();
+   mpParserDef = &mParserDef;
+   mpContext = &mContext;
+   mpActiveOption = nullptr;
+   mActiveCount = 0;
+   mPosition = 0;
+   mPositionCount = 0;
+   mIgnoreOptions = false;
+
+   if ( words.empty() )
+      addCandidates( {} );
+   else {
+      for ( size_t i = 0; i + 1 < words.size(); ++i )
+         follow( words[i] );
+      addCandidates( words.back() );
+   }
+
+   stream.write( mOutput.data(), mOutput.size() );
+}
+
+// The words are classified like in Parser::getNextArgumentType.
+ARGUMENTUM_INLINE void Completer::follow( std::string_view word )
+{
+   if ( mIgnoreOptions ) {
+      addFreeArgument();
+      return;
+   }
+
+   ArgumentLexer lexer;
+   auto token = lexer.lex( word );
+   switch ( token.type ) {
+      case EArgumentType::include:
+         return;
+
+      case EArgumentType::endOfOptions:
+         mIgnoreOptions = true;
+         mpActiveOption = nullptr;
+         return;
+
+      case EArgumentType::longOption:
+         startOptions( token );
+         return;
+
+      case EArgumentType::shortOption:
+      case EArgumentType::multiOption:
+         if ( !token.isNumber
+               || ( mpActiveOption ? !acceptsValue()
+                                   : mpParserDef->findOption( word.substr( 0, 2 ) ) != nullptr ) ) {
+            startOptions( token );
+            return;
+         }
+         break;
+
+      default:
+         break;
+   }
+
+   if ( acceptsValue() ) {
+      ++mActiveCount;
+      if ( !acceptsValue() )
+         mpActiveOption = nullptr;
+      return;
+   }
+
+   auto pCommand = mpParserDef->matchCommand( word );
+   if ( pCommand )
+      enterCommand( *pCommand );
+   else
+      addFreeArgument();
+}
+
+ARGUMENTUM_INLINE void Completer::startOptions( const ArgumentToken& token )
+{
+   auto text = token.text;
+   if ( token.type == EArgumentType::multiOption ) {
+      auto name = std::string{ "--" };
+      for ( size_t i = 1; i < text.size(); ++i ) {
+         name[1] = text[i];
+         startOption( name, false );
+      }
+      return;
+   }
+
+   if ( token.commapos != std::string_view::npos ) {
+      auto pOption = mpParserDef->findOption( text.substr( 0, token.commapos ) );
+      if ( pOption && pOption->isForwarded() && token.commapos + 1 < text.size() ) {
+         mpActiveOption = nullptr;
+         return;
+      }
+   }
+
+   startOption( text.substr( 0, token.eqpos ), token.eqpos != std::string_view::npos );
+}
+
+ARGUMENTUM_INLINE void Completer::startOption( std::string_view name, bool hasValue )
+{
+   mpActiveOption = mpParserDef->findOption( name );
+   mActiveCount = hasValue ? 1 : 0;
+   if ( mpActiveOption && !acceptsValue() )
+      mpActiveOption = nullptr;
+}
+
+ARGUMENTUM_INLINE bool Completer::acceptsValue() const
+{
+   if ( !mpActiveOption )
+      return false;
+
+   auto [minArgs, maxArgs] = mpActiveOption->getArgumentCounts();
+   return maxArgs < 0 || mActiveCount < maxArgs || mActiveCount < minArgs;
+}
+
+ARGUMENTUM_INLINE void Completer::addFreeArgument()
+{
+   auto& positional = mpParserDef->mPositional;
+   while ( mPosition < positional.size() ) {
+      auto [minArgs, maxArgs] = positional[mPosition]->getArgumentCounts();
+      if ( maxArgs < 0 || mPositionCount < maxArgs ) {
+         ++mPositionCount;
+         return;
+      }
+      ++mPosition;
+      mPositionCount = 0;
+   }
+}
+
+ARGUMENTUM_INLINE const Option* Completer::findCurrentPositional() const
+{
+   auto& positional = mpParserDef->mPositional;
+   auto count = mPositionCount;
+   for ( auto position = mPosition; position < positional.size(); ++position, count = 0 ) {
+      auto [minArgs, maxArgs] = positional[position]->getArgumentCounts();
+      if ( maxArgs < 0 || count < maxArgs )
+         return positional[position].get();
+   }
+
+   return nullptr;
+}
+
+// The options of the command are completed with the parser that would parse
+// them.
+ARGUMENTUM_INLINE void Completer::enterCommand( Command& command )
+{
+   auto& parser = Parser::getCommandParser( *mpParserDef, *mpContext, command );
+   parser.verifyDefinedOptions();
+   mpParserDef = &parser.mParserDef;
+   mpContext = &parser.mContext;
+
+   mpActiveOption = nullptr;
+   mActiveCount = 0;
+   mPosition = 0;
+   mPositionCount = 0;
+   mIgnoreOptions = false;
+}
+
+ARGUMENTUM_INLINE void Completer::addCandidates( std::string_view word )
+{
+   if ( !mIgnoreOptions ) {
+      // An option that needs more values receives the word even if it
+      // starts with a dash.
+      if ( mpActiveOption && mActiveCount < std::get<0>( mpActiveOption->getArgumentCounts() ) ) {
+         addChoices( *mpActiveOption, word, {} );
+         return;
+      }
+
+      // The value of a long option can follow an equal sign.
+      if ( !word.empty() && word[0] == '-' ) {
+         auto eqpos = word.find( '=' );
+         if ( word.substr( 0, 2 ) != "--" || eqpos == std::string_view::npos )
+            addNames( word, true );
+         else {
+            auto pOption = mpParserDef->findOption( word.substr( 0, eqpos ) );
+            if ( pOption )
+               addChoices( *pOption, word.substr( eqpos + 1 ), word.substr( 0, eqpos + 1 ) );
+         }
+         return;
+      }
+
+      if ( acceptsValue() ) {
+         addChoices( *mpActiveOption, word, {} );
+         return;
+      }
+
+      addNames( word, false );
+   }
+
+   auto pPositional = findCurrentPositional();
+   if ( pPositional )
+      addChoices( *pPositional, word, {} );
+}
+
+ARGUMENTUM_INLINE void Completer::addNames( std::string_view prefix, bool options )
+{
+   auto& trie = mpContext->getCompletionTrie( *mpParserDef );
+   auto [pBegin, pEnd] = trie.findPrefix( prefix );
+   auto kind = options ? CompletionTrie::optionName : CompletionTrie::commandName;
+   for ( auto pEntry = pBegin; pEntry != pEnd; ++pEntry ) {
+      if ( pEntry->kind != kind )
+         continue;
+      if ( kind == CompletionTrie::optionName )
+         addCandidate( pEntry->name, mpParserDef->mOptions[pEntry->index]->getRawHelp() );
+      else
+         addCandidate( pEntry->name, mpParserDef->mCommands[pEntry->index]->getHelp() );
+   }
+}
+
+ARGUMENTUM_INLINE void Completer::addChoices(
+      const Option& option, std::string_view prefix, std::string_view lead )
+{
+   for ( auto& choice : option.getChoices() ) {
+      if ( choice.compare( 0, prefix.size(), prefix ) != 0 )
+         continue;
+      if ( lead.empty() )
+         addCandidate( choice, {} );
+      else
+         addCandidate( std::string{ lead } + choice, {} );
+   }
+}
+
+ARGUMENTUM_INLINE void Completer::addCandidate(
+      std::string_view name, std::string_view description )
+{
+   if ( mShell == zsh ) {
+      // A colon separates the description in _describe.
+      for ( auto ch : name ) {
+         if ( ch == ':' )
+            mOutput += '\\';
+         mOutput += ch;
+      }
+   }
+   else
+      mOutput += name;
+
+   description = getFirstLine( description );
+   if ( !description.empty() && ( mShell == zsh || mShell == fish ) ) {
+      mOutput += mShell == zsh ? ':' : '\t';
+      mOutput += description;
+   }
+   mOutput += '\n';
+}
+
+ARGUMENTUM_INLINE std::string_view Completer::getFirstLine( std::string_view text )
+{
+   auto end = text.find( '\n' );
+   if ( end != std::string_view::npos )
+      text = text.substr( 0, end );
+   while ( !text.empty() && std::isspace( static_cast<unsigned char>( text.back() ) ) )
+      text.remove_suffix( 1 );
+   return text;
+}
+
+ARGUMENTUM_INLINE void Completer::writeScript( std::string_view shell, std::ostream& stream )
+{
+   mShell = findShell( shell );
+   if ( mShell == plain )
+      return;
+
+   // The script registers the completion for the name of the program.
+   if ( getProgramName().empty() ) {
+      Notifier::warn( "A completion script needs the name of the program in ParserConfig." );
+      return;
+   }
+
+   mOutput.clear();
+   collectScopes();
+   if ( mShell == fish )
+      writeFishScript();
+   else
+      writeShScript();
+
+   stream.write( mOutput.data(), mOutput.size() );
+}
+
+// Every command gets a scope with the index of its position in mScopes.  The
+// scope of the program is 0.
+ARGUMENTUM_INLINE void Completer::collectScopes()
+{
+   mScopes.clear();
+   mScopes.push_back( { &mParserDef, &mContext, 0, {} } );
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      if ( mScopes[i].depth >= maxScriptDepth )
+         continue;
+
+      auto& parserDef = *mScopes[i].pParserDef;
+      for ( auto& pCommand : parserDef.mCommands ) {
+         auto& parser = Parser::getCommandParser( parserDef, *mScopes[i].pContext, *pCommand );
+         parser.verifyDefinedOptions();
+         mScopes[i].commands.emplace_back( pCommand->getName(), mScopes.size() );
+         mScopes.push_back( { &parser.mParserDef, &parser.mContext, mScopes[i].depth + 1, {} } );
+      }
+   }
+}
+
+ARGUMENTUM_INLINE std::vector<std::string> Completer::getOptionCandidates(
+      const ParserDefinition& parserDef ) const
+{
+   std::vector<std::string> candidates;
+   for ( auto& pOption : parserDef.mOptions )
+      for ( auto pName : { &pOption->getLongName(), &pOption->getShortName() } )
+         if ( !pName->empty() )
+            candidates.push_back( formatCandidate( *pName, pOption->getRawHelp() ) );
+
+   return candidates;
+}
+
+// The commands and the choices of the positional options.
+ARGUMENTUM_INLINE std::vector<std::string> Completer::getArgumentCandidates(
+      const ParserDefinition& parserDef ) const
+{
+   std::vector<std::string> candidates;
+   for ( auto& pCommand : parserDef.mCommands )
+      candidates.push_back( formatCandidate( pCommand->getName(), pCommand->getHelp() ) );
+
+   for ( auto& pOption : parserDef.mPositional )
+      for ( auto& choice : pOption->getChoices() )
+         candidates.push_back( formatCandidate( choice, {} ) );
+
+   return candidates;
+}
+
+ARGUMENTUM_INLINE std::string Completer::formatCandidate(
+      std::string_view name, std::string_view description ) const
+{
+   description = getFirstLine( description );
+   if ( mShell == zsh ) {
+      std::string text;
+      for ( auto ch : name ) {
+         if ( ch == ':' )
+            text += '\\';
+         text += ch;
+      }
+      if ( !description.empty() ) {
+         text += ':';
+         text += description;
+      }
+      return quote( text );
+   }
+
+   if ( mShell == fish && !description.empty() )
+      return quote( name ) + "\\t" + quote( description );
+
+   return quote( name );
+}
+
+ARGUMENTUM_INLINE std::string Completer::quote( std::string_view text ) const
+{
+   std::string quoted = "'";
+   for ( auto ch : text ) {
+      if ( mShell == fish ) {
+         if ( ch == '\'' || ch == '\\' )
+            quoted += '\\';
+         quoted += ch;
+      }
+      else if ( ch == '\'' )
+         quoted += "'\\''";
+      else
+         quoted += ch;
+   }
+   quoted += '\'';
+   return quoted;
+}
+
+// The key of a word in a scope in the case statements of a script.
+ARGUMENTUM_INLINE std::string Completer::getScopeKey( size_t scope, std::string_view word )
+{
+   return std::to_string( scope ) + ":" + std::string( word );
+}
+
+// The shells look up the completion by the name of the command without the
+// directory, so a program name set from argv[0] is reduced to its base name.
+ARGUMENTUM_INLINE std::string_view Completer::getProgramName() const
+{
+   std::string_view program = mParserDef.getConfig().program();
+   auto pos = program.find_last_of( "/\\" );
+   return pos == std::string_view::npos ? program : program.substr( pos + 1 );
+}
+
+ARGUMENTUM_INLINE std::string Completer::getFunctionName() const
+{
+   std::string name = mShell == fish ? "__" : "_";
+   for ( auto ch : getProgramName() )
+      name += std::isalnum( static_cast<unsigned char>( ch ) ) ? ch : '_';
+
+   if ( mShell == fish )
+      name += "_complete";
+   return name;
+}
+
+ARGUMENTUM_INLINE void Completer::writeWordList(
+      const std::vector<std::string>& words, std::string_view indent )
+{
+   if ( mShell == fish ) {
+      mOutput.append( indent ).append( "set candidates" );
+      for ( auto& word : words )
+         mOutput.append( " \\\n" ).append( indent ).append( "   " ).append( word );
+      mOutput += '\n';
+      return;
+   }
+
+   mOutput.append( indent ).append( "candidates=(\n" );
+   for ( auto& word : words )
+      mOutput.append( indent ).append( "   " ).append( word ).append( "\n" );
+   mOutput.append( indent ).append( ")\n" );
+}
+
+// The scope changes when a word is the name of a command of the current
+// scope.
+ARGUMENTUM_INLINE void Completer::writeShCommandCases( std::string_view indent )
+{
+   for ( size_t i = 0; i < mScopes.size(); ++i )
+      for ( auto& [name, scope] : mScopes[i].commands ) {
+         mOutput.append( indent ).append( quote( getScopeKey( i, name ) ) );
+         mOutput.append( ") scope=" ).append( std::to_string( scope ) ).append( " ;;\n" );
+      }
+}
+
+// The scripts for bash and zsh differ only in the way they read the words
+// and return the candidates.
+ARGUMENTUM_INLINE void Completer::writeShScript()
+{
+   auto program = getProgramName();
+   auto function = getFunctionName();
+   auto isZsh = mShell == zsh;
+   if ( isZsh )
+      mOutput.append( "#compdef " ).append( program ).append( "\n" );
+   mOutput.append( "# " ).append( isZsh ? "zsh" : "bash" );
+   mOutput.append( " completion for " ).append( program ).append( ".\n\n" );
+
+   mOutput.append( function ).append( "()\n{\n" );
+   if ( isZsh ) {
+      mOutput.append( "   local cur=\"${words[CURRENT]}\" prev=\"\" scope=0 i\n"
+                      "   local -a candidates\n"
+                      "   for (( i = 2; i < CURRENT; ++i )); do\n"
+                      "      case \"$scope:${words[i]}\" in\n" );
+   }
+   else {
+      mOutput.append( "   local cur=\"${COMP_WORDS[COMP_CWORD]}\" prev=\"\" scope=0 word i\n"
+                      "   local -a candidates=()\n"
+                      "   for (( i = 1; i < COMP_CWORD; ++i )); do\n"
+                      "      case \"$scope:${COMP_WORDS[i]}\" in\n" );
+   }
+   writeShCommandCases( "         " );
+   mOutput.append( "      esac\n"
+                   "   done\n" );
+   if ( isZsh )
+      mOutput.append( "   (( CURRENT > 2 )) && prev=\"${words[CURRENT - 1]}\"\n" );
+   else
+      mOutput.append( "   (( COMP_CWORD > 1 )) && prev=\"${COMP_WORDS[COMP_CWORD - 1]}\"\n" );
+
+   // The values of the options.  The shell completes file names if an option
+   // has no choices.
+   mOutput.append( "   case \"$scope:$prev\" in\n" );
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      for ( auto& pOption : mScopes[i].pParserDef->mOptions ) {
+         if ( !pOption->acceptsAnyArguments() )
+            continue;
+         const char* separator = "      ";
+         for ( auto pName : { &pOption->getLongName(), &pOption->getShortName() } ) {
+            if ( pName->empty() )
+               continue;
+            mOutput.append( separator ).append( quote( getScopeKey( i, *pName ) ) );
+            separator = " | ";
+         }
+         mOutput.append( ")\n" );
+
+         std::vector<std::string> choices;
+         for ( auto& choice : pOption->getChoices() )
+            choices.push_back( formatCandidate( choice, {} ) );
+         if ( !choices.empty() )
+            writeWordList( choices, "         " );
+         mOutput.append( "         ;;\n" );
+      }
+   }
+
+   mOutput.append( "      *)\n"
+                   "         if [[ $cur == -* ]]; then\n"
+                   "            case $scope in\n" );
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      auto candidates = getOptionCandidates( *mScopes[i].pParserDef );
+      if ( candidates.empty() )
+         continue;
+      mOutput.append( "               " ).append( std::to_string( i ) ).append( ")\n" );
+      writeWordList( candidates, "                  " );
+      mOutput.append( "                  ;;\n" );
+   }
+   mOutput.append( "            esac\n"
+                   "         else\n"
+                   "            case $scope in\n" );
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      auto candidates = getArgumentCandidates( *mScopes[i].pParserDef );
+      if ( candidates.empty() )
+         continue;
+      mOutput.append( "               " ).append( std::to_string( i ) ).append( ")\n" );
+      writeWordList( candidates, "                  " );
+      mOutput.append( "                  ;;\n" );
+   }
+   mOutput.append( "            esac\n"
+                   "         fi\n"
+                   "         ;;\n"
+                   "   esac\n" );
+
+   if ( isZsh ) {
+      mOutput.append( "   if (( ${#candidates} )); then\n"
+                      "      _describe 'argument' candidates\n"
+                      "   else\n"
+                      "      _files\n"
+                      "   fi\n"
+                      "}\n\n" );
+      mOutput.append( "if [[ \"${funcstack[1]}\" == " ).append( function ).append( " ]]; then\n" );
+      mOutput.append( "   " ).append( function ).append( " \"$@\"\nelse\n" );
+      mOutput.append( "   compdef " ).append( function ).append( " " ).append( quote( program ) );
+      mOutput.append( "\nfi\n" );
+   }
+   else {
+      mOutput.append( "   COMPREPLY=()\n"
+                      "   for word in \"${candidates[@]}\"; do\n"
+                      "      [[ $word == \"$cur\"* ]] && COMPREPLY+=( \"$word\" )\n"
+                      "   done\n"
+                      "}\n\n" );
+      mOutput.append( "complete -o default -F " ).append( function ).append( " " );
+      mOutput.append( quote( program ) ).append( "\n" );
+   }
+}
+
+ARGUMENTUM_INLINE void Completer::writeFishScript()
+{
+   auto program = getProgramName();
+   auto function = getFunctionName();
+   mOutput.append( "# fish completion for " ).append( program ).append( ".\n\n" );
+   mOutput.append( "function " ).append( function ).append( "\n" );
+   mOutput.append( "   set -l tokens (commandline -opc)\n"
+                   "   set -l cur (commandline -ct)\n"
+                   "   set -l scope 0\n"
+                   "   set -l i 2\n"
+                   "   while test $i -le (count $tokens)\n"
+                   "      switch \"$scope:$tokens[$i]\"\n" );
+   for ( size_t i = 0; i < mScopes.size(); ++i )
+      for ( auto& [name, scope] : mScopes[i].commands ) {
+         mOutput.append( "         case " );
+         mOutput.append( quote( getScopeKey( i, name ) ) ).append( "\n" );
+         mOutput.append( "            set scope " ).append( std::to_string( scope ) );
+         mOutput.append( "\n" );
+      }
+   mOutput.append( "      end\n"
+                   "      set i (math $i + 1)\n"
+                   "   end\n"
+                   "   set -l prev ''\n"
+                   "   if test (count $tokens) -gt 1\n"
+                   "      set prev $tokens[-1]\n"
+                   "   end\n"
+                   "   set -l candidates\n"
+                   "   switch \"$scope:$prev\"\n" );
+
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      for ( auto& pOption : mScopes[i].pParserDef->mOptions ) {
+         if ( !pOption->acceptsAnyArguments() )
+            continue;
+         mOutput.append( "      case" );
+         for ( auto pName : { &pOption->getLongName(), &pOption->getShortName() } )
+            if ( !pName->empty() )
+               mOutput.append( " " ).append( quote( getScopeKey( i, *pName ) ) );
+         mOutput.append( "\n" );
+
+         std::vector<std::string> choices;
+         for ( auto& choice : pOption->getChoices() )
+            choices.push_back( formatCandidate( choice, {} ) );
+         if ( !choices.empty() )
+            writeWordList( choices, "         " );
+      }
+   }
+
+   mOutput.append( "      case '*'\n"
+                   "         if string match -q -- '-*' \"$cur\"\n"
+                   "            switch $scope\n" );
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      auto candidates = getOptionCandidates( *mScopes[i].pParserDef );
+      if ( candidates.empty() )
+         continue;
+      mOutput.append( "               case " ).append( std::to_string( i ) ).append( "\n" );
+      writeWordList( candidates, "                  " );
+   }
+   mOutput.append( "            end\n"
+                   "         else\n"
+                   "            switch $scope\n" );
+   for ( size_t i = 0; i < mScopes.size(); ++i ) {
+      auto candidates = getArgumentCandidates( *mScopes[i].pParserDef );
+      if ( candidates.empty() )
+         continue;
+      mOutput.append( "               case " ).append( std::to_string( i ) ).append( "\n" );
+      writeWordList( candidates, "                  " );
+   }
+   mOutput.append( "            end\n"
+                   "         end\n"
+                   "   end\n"
+                   "   if test (count $candidates) -gt 0\n"
+                   "      printf '%s\\n' $candidates\n"
+                   "   else\n"
+                   "      __fish_complete_path \"$cur\"\n"
+                   "   end\n"
+                   "end\n\n" );
+   mOutput.append( "complete -c " ).append( quote( program ) ).append( " -f -a '(" );
+   mOutput.append( function ).append( ")'\n" );
+}
+
+}   // namespace argumentum
@@ -0,0 +1,93 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argumentum {
+
+class ParserDefinition;
+
+/**
+ * A trie of the option and command names that can complete a word.  The
+ * nodes and the edges are stored in flat arrays like in CommandTrie.  The
+ * names are sorted so the names that start with the text of a node form a
+ * range of entries that is stored in the node.  The candidates for a prefix
+ * are found in O(length) steps.
+ *
+ * The same trie finds the names that are similar to an unknown option.
+ */
+class CompletionTrie
+{
+public:
+   enum EKind : uint8_t { optionName, commandName };
+
+   struct Entry
+   {
+      // A view of the name stored in the option or the command.
+      std::string_view name;
+      EKind kind;
+
+      // The index of the option in ParserDefinition::mOptions or of the
+      // command in ParserDefinition::mCommands.
+      uint32_t index;
+   };
+
+   struct Match
+   {
+      const Entry* pEntry;
+      unsigned distance;
+   };
+
+private:
+   struct Node
+   {
+      uint32_t firstEdge = 0;
+      uint32_t edgeCount = 0;
+      uint32_t firstEntry = 0;
+      uint32_t endEntry = 0;
+   };
+
+   struct Edge
+   {
+      char label;
+      uint32_t target;
+   };
+
+   std::vector<Entry> mEntries;
+   std::vector<Node> mNodes;
+   std::vector<Edge> mEdges;
+
+public:
+   // Add the names of the options and the commands of @p parserDef.  The
+   // names must not change while the trie is used.
+   void build( const ParserDefinition& parserDef );
+   void clear();
+
+   // The entries whose names start with @p prefix, ordered by name.
+   std::pair<const Entry*, const Entry*> findPrefix( std::string_view prefix ) const;
+
+   /**
+    * Find at most @p maxMatches entries of @p kind whose names are at most
+    * @p maxDistance edits away from @p word.  An edit inserts, deletes or
+    * replaces a character or swaps two adjacent characters.  The matches are
+    * ordered by distance and by name.
+    *
+    * The trie is walked depth first in the order of the names with a row of
+    * the distance matrix for each depth.  Only the cells near the diagonal are
+    * computed and a branch is dropped when none of them is within the
+    * distance.  When @p maxMatches are found the distance is lowered below the
+    * distance of the last match.  The cost depends mostly on the number of
+    * prefixes within the distance, which still grows with the number of
+    * names: a query for two edits takes about three times longer with 10000
+    * names than with 200.
+    */
+   void findSimilar( std::string_view word, unsigned maxDistance, EKind kind,
+         size_t maxMatches, std::vector<Match>& matches ) const;
+};
+
+}   // namespace argumentum
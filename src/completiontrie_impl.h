@@ -0,0 +1,209 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "completiontrie.h"
+
+#include "command.h"
+#include "option.h"
+#include "parserdefinition.h"
+
+#include <algorithm>
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE void CompletionTrie::build( const ParserDefinition& parserDef )
+{
+   clear();
+   for ( size_t i = 0; i < parserDef.mOptions.size(); ++i ) {
+      auto& option = *parserDef.mOptions[i];
+      for ( auto pName : { &option.getShortName(), &option.getLongName() } )
+         if ( !pName->empty() )
+            mEntries.push_back( { *pName, optionName, static_cast<uint32_t>( i ) } );
+   }
+
+   for ( size_t i = 0; i < parserDef.mCommands.size(); ++i ) {
+      auto& name = parserDef.mCommands[i]->getName();
+      mEntries.push_back( { name, commandName, static_cast<uint32_t>( i ) } );
+   }
+
+   std::sort( mEntries.begin(), mEntries.end(), []( const Entry& a, const Entry& b ) {
+      auto order = a.name.compare( b.name );
+      return order < 0 || ( order == 0 && a.index < b.index );
+   } );
+
+   // The names are inserted in order, so the children of a node are created
+   // in the order of their labels and only the path of the previous name can
+   // be extended.  A node that leaves the path has no more entries.  The
+   // parents and the labels are remembered until the edges are laid out.
+   std::vector<uint32_t> parents( 1 );
+   std::vector<char> labels( 1 );
+   std::vector<uint32_t> path( 1, 0 );
+   mNodes.resize( 1 );
+   std::string_view previous;
+   for ( uint32_t i = 0; i < mEntries.size(); ++i ) {
+      auto name = mEntries[i].name;
+      auto common = std::mismatch( name.begin(), name.end(), previous.begin(), previous.end() );
+      auto depth = 1 + static_cast<size_t>( common.first - name.begin() );
+      for ( auto ipath = path.begin() + depth; ipath != path.end(); ++ipath )
+         mNodes[*ipath].endEntry = i;
+      path.resize( depth );
+
+      for ( auto it = common.first; it != name.end(); ++it ) {
+         auto node = static_cast<uint32_t>( mNodes.size() );
+         mNodes.push_back( { 0, 0, i, i } );
+         parents.push_back( path.back() );
+         labels.push_back( *it );
+         path.push_back( node );
+      }
+      previous = name;
+   }
+
+   for ( auto node : path )
+      mNodes[node].endEntry = static_cast<uint32_t>( mEntries.size() );
+
+   // The edges of a node are contiguous.  They are ordered like the names,
+   // by the unsigned values of their labels.
+   for ( size_t node = 1; node < mNodes.size(); ++node )
+      ++mNodes[parents[node]].edgeCount;
+
+   uint32_t firstEdge = 0;
+   for ( auto& node : mNodes ) {
+      node.firstEdge = firstEdge;
+      firstEdge += node.edgeCount;
+      node.edgeCount = 0;
+   }
+
+   mEdges.resize( firstEdge );
+   for ( size_t node = 1; node < mNodes.size(); ++node ) {
+      auto& parent = mNodes[parents[node]];
+      mEdges[parent.firstEdge + parent.edgeCount++] = { labels[node], uint32_t( node ) };
+   }
+}
+
+ARGUMENTUM_INLINE void CompletionTrie::clear()
+{
+   mEntries.clear();
+   mNodes.clear();
+   mEdges.clear();
+}
+
+ARGUMENTUM_INLINE auto CompletionTrie::findPrefix( std::string_view prefix ) const
+      -> std::pair<const Entry*, const Entry*>
+{
+   if ( mNodes.empty() )
+      return { nullptr, nullptr };
+
+   const Node* pNode = &mNodes[0];
+   for ( auto ch : prefix ) {
+      auto ibegin = mEdges.begin() + pNode->firstEdge;
+      auto iend = ibegin + pNode->edgeCount;
+      auto it = std::lower_bound( ibegin, iend, ch, []( const Edge& edge, char label ) {
+         return static_cast<unsigned char>( edge.label ) < static_cast<unsigned char>( label );
+      } );
+      if ( it == iend || it->label != ch )
+         return { nullptr, nullptr };
+      pNode = &mNodes[it->target];
+   }
+
+   auto pEntries = mEntries.data();
+   return { pEntries + pNode->firstEntry, pEntries + pNode->endEntry };
+}
+
+ARGUMENTUM_INLINE void CompletionTrie::findSimilar( std::string_view word, unsigned maxDistance,
+      EKind kind, size_t maxMatches, std::vector<Match>& matches ) const
+{
+   matches.clear();
+   if ( mNodes.empty() || maxMatches == 0 )
+      return;
+
+   // The row of a node at depth d holds the distances between the first d
+   // characters of the node's text and the prefixes of the word.  A name
+   // longer than the word by more than the distance can not match.  The cells
+   // outside of the band around the diagonal hold the cap.
+   const size_t width = word.size() + 1;
+   const unsigned cap = maxDistance + 1;
+   std::vector<unsigned> rows( ( word.size() + maxDistance + 1 ) * width, cap );
+   std::vector<char> text( word.size() + maxDistance + 1 );
+   for ( size_t j = 0; j < width && j <= maxDistance; ++j )
+      rows[j] = unsigned( j );
+
+   struct Visit
+   {
+      uint32_t node;
+      uint32_t depth;
+      char label;
+   };
+   std::vector<Visit> stack;
+   auto limit = maxDistance;
+
+   // The children are pushed in reverse so that the names are visited in
+   // order.  A later name replaces a match only if it is closer.
+   auto pushChildren = [&]( const Node& node, uint32_t depth ) {
+      if ( depth < word.size() + limit )
+         for ( auto i = node.firstEdge + node.edgeCount; i > node.firstEdge; --i )
+            stack.push_back( { mEdges[i - 1].target, depth + 1, mEdges[i - 1].label } );
+   };
+   auto addMatch = [&]( const Entry& entry, unsigned distance ) {
+      auto it = std::upper_bound( matches.begin(), matches.end(), distance,
+            []( unsigned distance, const Match& match ) { return distance < match.distance; } );
+      matches.insert( it, { &entry, distance } );
+      if ( matches.size() > maxMatches )
+         matches.pop_back();
+   };
+
+   pushChildren( mNodes[0], 0 );
+   while ( !stack.empty() ) {
+      auto visit = stack.back();
+      stack.pop_back();
+
+      auto& node = mNodes[visit.node];
+      size_t depth = visit.depth;
+      char ch = visit.label;
+      text[depth] = ch;
+
+      auto pRow = &rows[depth * width];
+      auto pUp = pRow - width;
+      auto lo = depth > limit ? depth - limit : 1;
+      auto hi = std::min( word.size(), depth + limit );
+      if ( lo > hi )
+         continue;
+
+      pRow[lo - 1] = lo == 1 ? unsigned( std::min<size_t>( depth, cap ) ) : cap;
+      if ( hi < word.size() )
+         pRow[hi + 1] = cap;
+
+      auto best = pRow[lo - 1];
+      for ( auto j = lo; j <= hi; ++j ) {
+         auto cost = word[j - 1] == ch ? 0u : 1u;
+         auto distance = std::min( { pUp[j - 1] + cost, pUp[j] + 1, pRow[j - 1] + 1 } );
+         if ( depth > 1 && j > 1 && word[j - 1] == text[depth - 1] && word[j - 2] == ch )
+            distance = std::min( distance, pUp[j - width - 2] + 1 );
+         pRow[j] = std::min( distance, cap );
+         best = std::min( best, pRow[j] );
+      }
+
+      if ( best > limit )
+         continue;
+
+      // The node is the end of a name if the first name in its range is as
+      // long as the node's text.
+      if ( hi == word.size() && pRow[hi] <= limit ) {
+         auto end = node.endEntry;
+         for ( auto i = node.firstEntry; i < end && mEntries[i].name.size() == depth; ++i )
+            if ( mEntries[i].kind == kind )
+               addMatch( mEntries[i], pRow[hi] );
+
+         if ( matches.size() == maxMatches ) {
+            if ( matches.back().distance == 0 )
+               return;
+            limit = matches.back().distance - 1;
+         }
+      }
+
+      pushChildren( node, uint32_t( depth ) );
+   }
+}
+
+}   // namespace argumentum
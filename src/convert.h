@@ -3,56 +3,88 @@
 
 #pragma once
 
+#include <cctype>
 #include <cerrno>
+#include <charconv>
+#include <cstdlib>
 #include <limits>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
+// Floating point std::from_chars is not available in all standard libraries.
+// Define ARGUMENTUM_NO_FLOAT_FROM_CHARS to always use strtod.
+#if defined( __cpp_lib_to_chars ) && !defined( ARGUMENTUM_NO_FLOAT_FROM_CHARS )
+#define ARGUMENTUM_HAS_FLOAT_FROM_CHARS
+#endif
+
 namespace argumentum {
 
+// Returns the sign defined by a sequence of signs that may be preceded by
+// white space and the length of the prefix.  An odd number of minus signs
+// gives a negative sign.
+std::tuple<int, size_t> parse_sign_prefix( std::string_view sv );
+
+// Returns the sign, the base and the length of the prefix of an integer.  The
+// prefix is an optional run of white space and an arbitrary sequence of signs
+// followed by an optional base prefix 0b, 0o, 0d or 0x.
 std::tuple<int, int, int> parse_int_prefix( std::string_view sv );
+
+// Returns the sign and the length of the prefix of a floating point number.
+// The hexadecimal prefix 0x or 0X is not included in the length.
 std::tuple<int, int> parse_float_prefix( std::string_view sv );
 
+// Converts the text to an integer.  Characters after the last digit are
+// ignored.  Throws std::invalid_argument if there are no digits and
+// std::out_of_range if the value does not fit into T.
 template<typename T>
-T parse_int( const std::string& s )
+T parse_int( std::string_view s )
 {
-   std::string_view sv( s );
-   auto [sign, base, skip] = parse_int_prefix( sv );
-   if ( skip > 0 )
-      sv = sv.substr( skip );
+   auto [sign, base, skip] = parse_int_prefix( s );
+   auto sv = s.substr( skip );
 
-   struct ClearErrno
-   {
-      ~ClearErrno()
-      {
-         errno = 0;
+   unsigned long long magnitude = 0;
+   auto res = std::from_chars( sv.data(), sv.data() + sv.size(), magnitude, base );
+   if ( res.ec == std::errc::invalid_argument )
+      throw std::invalid_argument( std::string{ s } );
+   if ( res.ec == std::errc::result_out_of_range )
+      throw std::out_of_range( std::string{ s } );
+
+   using limits = std::numeric_limits<T>;
+   const auto max = static_cast<unsigned long long>( limits::max() );
+   if constexpr ( limits::is_signed ) {
+      if ( sign > 0 ) {
+         if ( magnitude > max )
+            throw std::out_of_range( std::string{ s } );
+         return static_cast<T>( magnitude );
       }
-   } clear_errno;
 
-   char* pend;
-   auto checkResult = [&]( auto res ) {
-      if ( errno == ERANGE )
-         throw std::out_of_range( s );
-      if ( errno == EINVAL || pend == sv.data() )
-         throw std::invalid_argument( s );
-      if ( res < std::numeric_limits<T>::min() || res > std::numeric_limits<T>::max() )
-         throw std::out_of_range( s );
-      return static_cast<T>( res );
-   };
-
-   if constexpr ( std::numeric_limits<T>::is_signed )
-      return checkResult( sign * strtoll( sv.data(), &pend, base ) );
+      // The magnitude of min() is max() + 1.
+      if ( magnitude == 0 )
+         return 0;
+      if ( magnitude - 1 > max )
+         throw std::out_of_range( std::string{ s } );
+      return static_cast<T>( -static_cast<T>( magnitude - 1 ) - 1 );
+   }
    else {
-      if ( sign > 0 )
-         return checkResult( strtoull( sv.data(), &pend, base ) );
-      else
-         throw std::out_of_range( s );
+      if ( sign < 0 || magnitude > max )
+         throw std::out_of_range( std::string{ s } );
+      return static_cast<T>( magnitude );
    }
 }
 
+template<typename T>
+T check_float_range( T value, std::string_view s )
+{
+   if ( value < -std::numeric_limits<T>::max() || value > std::numeric_limits<T>::max() )
+      throw std::out_of_range( std::string{ s } );
+   return value;
+}
+
 namespace strtodx {
 template<typename T>
 T parse( const char* pdata, char** pend )
@@ -71,13 +103,19 @@ inline long double parse<long double>( const char* pdata, char** pend )
 }
 }   // namespace strtodx
 
+// Converts the text to a floating point number with strtod.  The conversion
+// depends on the current locale.
 template<typename T>
-T parse_float( const std::string& s )
+T parse_float_strtod( std::string_view s )
 {
-   std::string_view sv( s );
-   auto [sign, skip] = parse_float_prefix( sv );
-   if ( skip > 0 )
-      sv = sv.substr( skip );
+   auto [sign, skip] = parse_float_prefix( s );
+   // strtod would skip the white space after the signs.
+   auto first = s.substr( skip, 1 );
+   if ( !first.empty() && std::isspace( static_cast<unsigned char>( first[0] ) ) )
+      throw std::invalid_argument( std::string{ s } );
+
+   // strtod needs a zero terminated string.
+   auto str = std::string{ s.substr( skip ) };
 
    struct ClearErrno
    {
@@ -88,46 +126,127 @@ T parse_float( const std::string& s )
    } clear_errno;
 
    char* pend;
-   auto checkResult = [&]( auto res ) {
-      if ( errno == ERANGE )
-         throw std::out_of_range( s );
-      if ( errno == EINVAL || pend == sv.data() )
-         throw std::invalid_argument( s );
-      if ( res < -std::numeric_limits<T>::max() || res > std::numeric_limits<T>::max() )
-         throw std::out_of_range( s );
-      return static_cast<T>( res );
-   };
-
-   return checkResult( sign * strtodx::parse<T>( sv.data(), &pend ) );
+   auto res = strtodx::parse<T>( str.c_str(), &pend );
+   if ( errno == ERANGE )
+      throw std::out_of_range( std::string{ s } );
+   if ( errno == EINVAL || pend == str.c_str() )
+      throw std::invalid_argument( std::string{ s } );
+
+   return check_float_range<T>( sign * res, s );
 }
 
+#ifdef ARGUMENTUM_HAS_FLOAT_FROM_CHARS
+// Converts the text to a floating point number with std::from_chars.  The
+// conversion does not depend on the current locale.
+template<typename T>
+T parse_float_from_chars( std::string_view s )
+{
+   auto [sign, skip] = parse_float_prefix( s );
+   auto sv = s.substr( skip );
+
+   auto format = std::chars_format::general;
+   if ( sv.size() > 1 && sv[0] == '0' && ( sv[1] == 'x' || sv[1] == 'X' ) ) {
+      sv.remove_prefix( 2 );
+      format = std::chars_format::hex;
+   }
+
+   T value = 0;
+   auto res = std::from_chars( sv.data(), sv.data() + sv.size(), value, format );
+   if ( res.ec == std::errc::invalid_argument ) {
+      // Without hexadecimal digits strtod converts only the 0 of the prefix.
+      if ( format == std::chars_format::hex )
+         return sign * T( 0 );
+      throw std::invalid_argument( std::string{ s } );
+   }
+   if ( res.ec == std::errc::result_out_of_range )
+      throw std::out_of_range( std::string{ s } );
+
+   return check_float_range<T>( sign * value, s );
+}
+#endif
+
+// Converts the text to a floating point number.  Characters after the number
+// are ignored.  Throws std::invalid_argument if the text does not start with
+// a number and std::out_of_range if the value does not fit into T.
+template<typename T>
+T parse_float( std::string_view s )
+{
+#ifdef ARGUMENTUM_HAS_FLOAT_FROM_CHARS
+   return parse_float_from_chars<T>( s );
+#else
+   return parse_float_strtod<T>( s );
+#endif
+}
+
+// Converts a string to a value of type T.  A specialization defines a static
+// method convert that accepts either a std::string_view or a std::string.  The
+// string_view version avoids a copy of the argument.
 template<typename T, typename Enable = void>
 struct from_string
 {
 };
 
+// Check if from_string<T>::convert accepts a std::string_view.
+template<typename T, typename = void>
+struct has_view_from_string : std::false_type
+{};
+
+template<typename T>
+struct has_view_from_string<T,
+      std::void_t<decltype( from_string<T>::convert( std::declval<std::string_view>() ) )>>
+   : std::true_type
+{};
+
+// Check if from_string<T>::convert accepts a std::string.
+template<typename T, typename = void>
+struct has_string_from_string : std::false_type
+{};
+
+template<typename T>
+struct has_string_from_string<T,
+      std::void_t<decltype( from_string<T>::convert( std::declval<const std::string&>() ) )>>
+   : std::true_type
+{};
+
+template<typename T>
+struct has_from_string
+   : std::integral_constant<bool,
+           has_view_from_string<T>::value || has_string_from_string<T>::value>
+{};
+
+// Converts @p s with from_string<T>.  A copy of @p s is made only if
+// from_string<T>::convert does not accept a std::string_view.
+template<typename T>
+auto convert_from_string( std::string_view s )
+{
+   if constexpr ( has_view_from_string<T>::value )
+      return from_string<T>::convert( s );
+   else
+      return from_string<T>::convert( std::string{ s } );
+}
+
 template<typename T>
 struct from_string<std::optional<T>>
 {
-   static T convert( const std::string& s )
+   static T convert( std::string_view s )
    {
-      return from_string<T>::convert( s );
+      return convert_from_string<T>( s );
    }
 };
 
 template<>
 struct from_string<std::string>
 {
-   static std::string convert( const std::string& s )
+   static std::string convert( std::string_view s )
    {
-      return s;
+      return std::string{ s };
    }
 };
 
 template<>
 struct from_string<bool>
 {
-   static bool convert( const std::string& s )
+   static bool convert( std::string_view s )
    {
       return parse_int<int>( s );
    }
@@ -136,7 +255,7 @@ struct from_string<bool>
 template<typename T>
 struct from_string<T, typename std::enable_if<std::is_integral<T>::value>::type>
 {
-   static T convert( const std::string& s )
+   static T convert( std::string_view s )
    {
       return parse_int<T>( s );
    }
@@ -145,7 +264,7 @@ struct from_string<T, typename std::enable_if<std::is_integral<T>::value>::type>
 template<typename T>
 struct from_string<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
 {
-   static T convert( const std::string& s )
+   static T convert( std::string_view s )
    {
       return parse_float<T>( s );
    }
@@ -3,60 +3,67 @@
 
 #pragma once
 
-#include <regex>
+#include "convert.h"
+
 #include <string_view>
 
 namespace argumentum {
 
+ARGUMENTUM_INLINE std::tuple<int, size_t> parse_sign_prefix( std::string_view sv )
+{
+   // strtod and strtoll skip the white space in front of the sign but not
+   // after it.
+   auto isSpace = []( char ch ) {
+      return ch == ' ' || ( ch >= '\t' && ch <= '\r' );
+   };
+
+   size_t pos = 0;
+   while ( pos < sv.size() && isSpace( sv[pos] ) )
+      ++pos;
+
+   int negative = 0;
+   for ( ; pos < sv.size() && ( sv[pos] == '-' || sv[pos] == '+' ); ++pos )
+      negative ^= sv[pos] == '-';
+
+   return std::make_tuple( negative ? -1 : 1, pos );
+}
+
 ARGUMENTUM_INLINE std::tuple<int, int, int> parse_int_prefix( std::string_view sv )
 {
-   static auto rxPrefix = std::regex( "^([-+]*)(0[bdox])?" );
-   int sign = 1;
+   auto [sign, pos] = parse_sign_prefix( sv );
    int base = 10;
-   std::match_results<std::string_view::iterator> m;
-   if ( std::regex_search( sv.begin(), sv.end(), m, rxPrefix ) ) {
-      if ( m.length( 1 ) )
-         sign = std::count( m[1].first, m[1].second, '-' ) % 2 ? -1 : 1;
-      if ( m.length( 2 ) ) {
-         switch ( *( m[2].first + 1 ) ) {
-            case 'b':
-               base = 2;
-               break;
-            case 'd':
-               base = 10;
-               break;
-            case 'o':
-               base = 8;
-               break;
-            case 'x':
-               base = 16;
-               break;
-         }
+   if ( pos + 1 < sv.size() && sv[pos] == '0' ) {
+      switch ( sv[pos + 1] ) {
+         case 'b':
+            base = 2;
+            pos += 2;
+            break;
+         case 'd':
+            base = 10;
+            pos += 2;
+            break;
+         case 'o':
+            base = 8;
+            pos += 2;
+            break;
+         case 'x':
+            base = 16;
+            pos += 2;
+            break;
       }
-      return std::make_tuple( sign, base, static_cast<int>( m.length( 0 ) ) );
    }
-   return std::make_tuple( sign, base, 0 );
+
+   return std::make_tuple( sign, base, static_cast<int>( pos ) );
 }
 
 ARGUMENTUM_INLINE std::tuple<int, int> parse_float_prefix( std::string_view sv )
 {
-   static auto rxPrefix = std::regex( "^([-+]*)(0[dx])?" );
-   int sign = 1;
-   std::match_results<std::string_view::iterator> m;
-   if ( std::regex_search( sv.begin(), sv.end(), m, rxPrefix ) ) {
-      if ( m.length( 1 ) )
-         sign = std::count( m[1].first, m[1].second, '-' ) % 2 ? -1 : 1;
-      if ( m.length( 2 ) ) {
-         switch ( *( m[2].first + 1 ) ) {
-            case 'd':
-               return std::make_tuple( sign, static_cast<int>( m.length( 0 ) ) );
-            case 'x':
-               return std::make_tuple( sign, static_cast<int>( m.length( 1 ) ) );
-         }
-      }
-      return std::make_tuple( sign, static_cast<int>( m.length( 1 ) ) );
-   }
-   return std::make_tuple( sign, 0 );
+   auto [sign, pos] = parse_sign_prefix( sv );
+   // The hexadecimal prefix is handled by the conversion functions.
+   if ( pos + 1 < sv.size() && sv[pos] == '0' && sv[pos + 1] == 'd' )
+      pos += 2;
+
+   return std::make_tuple( sign, static_cast<int>( pos ) );
 }
 
 }   // namespace argumentum
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace argumentum {
+
+class ParserDefinition;
+
+/**
+ * An index of the option names that finds the names at most one edit away
+ * from a word.  An edit inserts, deletes or replaces a character or swaps two
+ * adjacent characters.  Two strings are at most one edit apart only if they
+ * are equal after at most one character is deleted from each of them.  Every
+ * name is therefore stored in a hash table as a whole and with each of its
+ * characters deleted in turn.  A word is looked up in the same way and the
+ * candidates are verified, so a lookup takes O(length) probes regardless of
+ * the number of names.
+ */
+class EditIndex
+{
+   struct Slot
+   {
+      uint32_t hash = 0;
+
+      // The index of the name + 1, 0 if the slot is empty.
+      uint32_t name = 0;
+
+      // The position of the deleted character or the length of the name.
+      uint32_t deleted = 0;
+   };
+
+   // The names are sorted.
+   std::vector<std::string_view> mNames;
+   std::vector<Slot> mSlots;
+
+public:
+   // Add the names of the options of @p parserDef.  The names must not change
+   // while the index is used.
+   void build( const ParserDefinition& parserDef );
+   void clear();
+
+   /**
+    * Find at most @p maxMatches names, but not more than eight, that are at
+    * most one edit away from @p word and store them in @p names ordered by
+    * distance and by name.
+    */
+   void findNeighbors(
+         std::string_view word, size_t maxMatches, std::vector<std::string_view>& names ) const;
+
+private:
+   void insert( uint32_t name, uint32_t deleted );
+   static uint32_t hashWithout( std::string_view text, size_t deleted );
+   static bool equalWithout(
+         std::string_view a, size_t deletedA, std::string_view b, size_t deletedB );
+   static unsigned distanceUpToOne( std::string_view a, std::string_view b );
+};
+
+}   // namespace argumentum
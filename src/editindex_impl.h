@@ -0,0 +1,164 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "editindex.h"
+
+#include "option.h"
+#include "parserdefinition.h"
+
+#include <algorithm>
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE void EditIndex::build( const ParserDefinition& parserDef )
+{
+   clear();
+   for ( auto& pOption : parserDef.mOptions )
+      for ( auto pName : { &pOption->getShortName(), &pOption->getLongName() } )
+         if ( !pName->empty() )
+            mNames.push_back( *pName );
+
+   std::sort( mNames.begin(), mNames.end() );
+   mNames.erase( std::unique( mNames.begin(), mNames.end() ), mNames.end() );
+
+   // The table is at most three quarters full.
+   size_t count = 0;
+   for ( auto name : mNames )
+      count += name.size() + 1;
+   size_t size = 16;
+   while ( size < count + count / 3 )
+      size *= 2;
+   mSlots.resize( size );
+
+   for ( uint32_t i = 0; i < mNames.size(); ++i )
+      for ( uint32_t deleted = 0; deleted <= mNames[i].size(); ++deleted )
+         insert( i, deleted );
+}
+
+ARGUMENTUM_INLINE void EditIndex::clear()
+{
+   mNames.clear();
+   mSlots.clear();
+}
+
+ARGUMENTUM_INLINE void EditIndex::insert( uint32_t name, uint32_t deleted )
+{
+   auto hash = hashWithout( mNames[name], deleted );
+   auto mask = mSlots.size() - 1;
+   auto pos = hash & mask;
+   while ( mSlots[pos].name != 0 )
+      pos = ( pos + 1 ) & mask;
+   mSlots[pos] = { hash, name + 1, deleted };
+}
+
+ARGUMENTUM_INLINE void EditIndex::findNeighbors(
+      std::string_view word, size_t maxMatches, std::vector<std::string_view>& names ) const
+{
+   names.clear();
+   if ( mSlots.empty() || maxMatches == 0 )
+      return;
+
+   // The names are found once for every deletion that makes them equal to the
+   // word.  The distance is verified because two strings that are equal after
+   // deleting a character from each of them can be two edits apart.
+   struct Found
+   {
+      unsigned distance;
+      uint32_t name;
+   };
+   Found found[8];
+   size_t foundCount = 0;
+   auto capacity = std::min( maxMatches, std::size( found ) );
+   auto mask = mSlots.size() - 1;
+   for ( size_t deleted = 0; deleted <= word.size(); ++deleted ) {
+      auto hash = hashWithout( word, deleted );
+      for ( auto pos = hash & mask; mSlots[pos].name != 0; pos = ( pos + 1 ) & mask ) {
+         auto& slot = mSlots[pos];
+         auto name = slot.name - 1;
+         if ( slot.hash != hash || !equalWithout( word, deleted, mNames[name], slot.deleted ) )
+            continue;
+
+         auto isFound = [&]( const Found& item ) { return item.name == name; };
+         if ( std::any_of( found, found + foundCount, isFound ) )
+            continue;
+
+         auto distance = distanceUpToOne( word, mNames[name] );
+         if ( distance > 1 )
+            continue;
+
+         // Only the best matches are kept.
+         Found item{ distance, name };
+         auto it = std::upper_bound( found, found + foundCount, item,
+               []( const Found& a, const Found& b ) {
+                  return a.distance < b.distance || ( a.distance == b.distance && a.name < b.name );
+               } );
+         if ( foundCount < capacity )
+            ++foundCount;
+         if ( it < found + foundCount ) {
+            std::move_backward( it, found + foundCount - 1, found + foundCount );
+            *it = item;
+         }
+      }
+   }
+
+   for ( size_t i = 0; i < foundCount; ++i )
+      names.push_back( mNames[found[i].name] );
+}
+
+ARGUMENTUM_INLINE uint32_t EditIndex::hashWithout( std::string_view text, size_t deleted )
+{
+   // FNV-1a
+   uint32_t hash = 2166136261u;
+   for ( size_t i = 0; i < text.size(); ++i ) {
+      if ( i != deleted ) {
+         hash ^= static_cast<unsigned char>( text[i] );
+         hash *= 16777619u;
+      }
+   }
+   return hash;
+}
+
+ARGUMENTUM_INLINE bool EditIndex::equalWithout(
+      std::string_view a, size_t deletedA, std::string_view b, size_t deletedB )
+{
+   auto lengthA = a.size() - ( deletedA < a.size() ? 1 : 0 );
+   auto lengthB = b.size() - ( deletedB < b.size() ? 1 : 0 );
+   if ( lengthA != lengthB )
+      return false;
+
+   for ( size_t i = 0, j = 0; i < a.size(); ++i, ++j ) {
+      if ( i == deletedA )
+         ++i;
+      if ( j == deletedB )
+         ++j;
+      if ( i < a.size() && a[i] != b[j] )
+         return false;
+   }
+   return true;
+}
+
+ARGUMENTUM_INLINE unsigned EditIndex::distanceUpToOne( std::string_view a, std::string_view b )
+{
+   if ( a.size() > b.size() )
+      std::swap( a, b );
+   if ( b.size() - a.size() > 1 )
+      return 2;
+
+   auto diff = std::mismatch( a.begin(), a.end(), b.begin() );
+   if ( diff.first == a.end() )
+      return unsigned( b.size() - a.size() );
+
+   auto i = size_t( diff.first - a.begin() );
+   if ( a.size() < b.size() )
+      return a.substr( i ) == b.substr( i + 1 ) ? 1 : 2;
+   if ( a.substr( i + 1 ) == b.substr( i + 1 ) )
+      return 1;
+   if ( i + 1 < a.size() && a[i] == b[i + 1] && a[i + 1] == b[i]
+         && a.substr( i + 2 ) == b.substr( i + 2 ) )
+      return 1;
+   return 2;
+}
+
+}   // namespace argumentum
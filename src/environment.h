@@ -21,7 +21,8 @@ class Environment
    const ParserDefinition& mParserDef;
 
 public:
-   Environment( Option& option, ParseResultBuilder& result, const ParserDefinition& parserDef );
+   Environment( const Option& option, ParseResultBuilder& result,
+         const ParserDefinition& parserDef );
    const ParserConfig::Data& get_config() const;
    const ParserDefinition& get_parser_def() const;
    std::shared_ptr<IFormatHelp> get_help_formatter( const std::string& optionName ) const;
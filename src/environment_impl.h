@@ -11,7 +11,7 @@
 namespace argumentum {
 
 ARGUMENTUM_INLINE Environment::Environment(
-      Option& option, ParseResultBuilder& result, const ParserDefinition& parserDef )
+      const Option& option, ParseResultBuilder& result, const ParserDefinition& parserDef )
    : mOption( option )
    , mResult( result )
    , mParserDef( parserDef )
@@ -4,21 +4,58 @@
 #pragma once
 
 #include "argumentstream.h"
+#include "mappedfilestream.h"
+#include "quotedargumentstream.h"
 
+#include <cstdint>
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <string>
 
+#if __has_include( <sys/stat.h> )
+#include <sys/stat.h>
+#define ARGUMENTUM_HAVE_STAT 1
+#else
+#define ARGUMENTUM_HAVE_STAT 0
+#endif
+
 namespace argumentum {
 
+// The properties of a file that change when the file is modified.
+struct FileStamp
+{
+   uint64_t inode = 0;
+   int64_t mtime = 0;
+   uint64_t size = 0;
+
+   bool operator==( const FileStamp& other ) const
+   {
+      return inode == other.inode && mtime == other.mtime && size == other.size;
+   }
+
+   bool operator!=( const FileStamp& other ) const
+   {
+      return !( *this == other );
+   }
+};
+
 // A virtual filesystem for opening streams of arguments.
 class Filesystem
 {
 public:
    virtual ~Filesystem() = default;
    virtual std::unique_ptr<ArgumentStream> open( const std::string& filename ) = 0;
+
+   // Returns the stamp of the file @p filename or nullopt if the file does not
+   // exist or the filesystem does not support stamps.
+   virtual std::optional<FileStamp> stamp( const std::string& )
+   {
+      return {};
+   }
 };
 
+// The default filesystem reads the files through an ifstream.
 class DefaultFilesystem : public Filesystem
 {
 public:
@@ -27,6 +64,64 @@ public:
       return std::make_unique<StdStreamArgumentStream>(
             std::make_unique<std::ifstream>( filename ) );
    }
+
+   std::optional<FileStamp> stamp( const std::string& filename ) override
+   {
+#if ARGUMENTUM_HAVE_STAT
+      struct stat st;
+      if ( ::stat( filename.c_str(), &st ) != 0 )
+         return {};
+
+      FileStamp stamp;
+      stamp.inode = static_cast<uint64_t>( st.st_ino );
+      stamp.size = static_cast<uint64_t>( st.st_size );
+#if defined( __linux__ )
+      stamp.mtime = int64_t( st.st_mtim.tv_sec ) * 1000000000 + st.st_mtim.tv_nsec;
+#elif defined( __APPLE__ )
+      stamp.mtime = int64_t( st.st_mtimespec.tv_sec ) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+      stamp.mtime = int64_t( st.st_mtime ) * 1000000000;
+#endif
+      return stamp;
+#else
+      (void)filename;
+      return {};
+#endif
+   }
+};
+
+// A filesystem that maps large regular files into memory.  Small files, where
+// mapping costs more than reading, and files that can not be mapped are read
+// through an ifstream.
+//
+// The arguments are read directly from the mapping.  If a mapped file is
+// truncated by another process while it is being parsed, reading the pages
+// past the new end raises SIGBUS.  Use this filesystem only for files that are
+// not modified while the program reads them.
+class MappedFilesystem : public DefaultFilesystem
+{
+public:
+   std::unique_ptr<ArgumentStream> open( const std::string& filename ) override
+   {
+      auto pMapped = MappedFileArgumentStream::open( filename, MappedFile::minMappedSize );
+      if ( pMapped )
+         return pMapped;
+
+      return DefaultFilesystem::open( filename );
+   }
+};
+
+// A filesystem that splits the files into arguments like the response files
+// of GCC: the arguments are separated by whitespace and may be quoted.  Large
+// files are memory mapped and must not be truncated while they are read, like
+// in MappedFilesystem.
+class QuotedFilesystem : public DefaultFilesystem
+{
+public:
+   std::unique_ptr<ArgumentStream> open( const std::string& filename ) override
+   {
+      return QuotedArgumentStream::open( filename );
+   }
 };
 
 }   // namespace argumentum
@@ -9,13 +9,19 @@
 namespace argumentum {
 
 class OptionGroup;
+class ParserDefinition;
 
 class GroupConfig
 {
    std::shared_ptr<OptionGroup> mpGroup;
 
+   // The definition that holds the group.  It is notified when the group
+   // changes.
+   ParserDefinition* mpParserDef = nullptr;
+
 public:
    GroupConfig( std::shared_ptr<OptionGroup> pGroup );
+   GroupConfig( std::shared_ptr<OptionGroup> pGroup, ParserDefinition& parserDef );
 
    // Set the title of the group that will be displayed in the generated help.
    GroupConfig& title( std::string_view title );
@@ -27,6 +33,9 @@ public:
    // Set to true if at least one option from the group must be present in the
    // input arguments.
    GroupConfig& required( bool isRequired = true );
+
+private:
+   void notifyChanged();
 };
 
 }   // namespace argumentum
@@ -6,6 +6,7 @@
 #include "groupconfig.h"
 
 #include "group.h"
+#include "parserdefinition.h"
 
 namespace argumentum {
 
@@ -13,22 +14,37 @@ ARGUMENTUM_INLINE GroupConfig::GroupConfig( std::shared_ptr<OptionGroup> pGroup
    : mpGroup( pGroup )
 {}
 
+ARGUMENTUM_INLINE GroupConfig::GroupConfig(
+      std::shared_ptr<OptionGroup> pGroup, ParserDefinition& parserDef )
+   : mpGroup( pGroup )
+   , mpParserDef( &parserDef )
+{}
+
 ARGUMENTUM_INLINE GroupConfig& GroupConfig::title( std::string_view title )
 {
    mpGroup->setTitle( title );
+   notifyChanged();
    return *this;
 }
 
 ARGUMENTUM_INLINE GroupConfig& GroupConfig::description( std::string_view description )
 {
    mpGroup->setDescription( description );
+   notifyChanged();
    return *this;
 }
 
 ARGUMENTUM_INLINE GroupConfig& GroupConfig::required( bool isRequired )
 {
    mpGroup->setRequired( isRequired );
+   notifyChanged();
    return *this;
 }
 
+ARGUMENTUM_INLINE void GroupConfig::notifyChanged()
+{
+   if ( mpParserDef )
+      mpParserDef->markChanged();
+}
+
 }   // namespace argumentum
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace argumentum {
+
+/**
+ * Keeps the help texts that were rendered for a parser definition.  A text is
+ * found only while the definition, the configuration of the parser and the
+ * settings of the formatter that rendered it are the same.  The cache can be
+ * used by multiple threads that parse with the same definition.
+ */
+class HelpCache
+{
+public:
+   struct Key
+   {
+      // The generation of the definition and the revision of the help texts
+      // in the parser configuration.
+      uint64_t generation = 0;
+      unsigned configRevision = 0;
+
+      // The settings of the formatter.
+      size_t textWidth = 0;
+      size_t argumentIndent = 0;
+      size_t maxDescriptionIndent = 0;
+
+      bool operator==( const Key& other ) const;
+   };
+
+private:
+   struct Entry
+   {
+      Key key;
+      std::shared_ptr<const std::string> pText;
+   };
+
+   // Only a few formatter settings are expected for one definition.  When a
+   // text is added to a full cache, the oldest text is dropped.
+   static constexpr size_t maxEntries = 4;
+
+   mutable std::mutex mMutex;
+   std::vector<Entry> mEntries;
+
+public:
+   HelpCache() = default;
+
+   // A copied or moved definition starts with an empty cache.
+   HelpCache( const HelpCache& );
+   HelpCache& operator=( const HelpCache& );
+
+   // Returns nullptr if the text for @p key is not in the cache.
+   std::shared_ptr<const std::string> find( const Key& key ) const;
+
+   // Returns the stored text.
+   std::shared_ptr<const std::string> store( const Key& key, std::string text );
+
+   // Returns true if a text was rendered for the generation of the
+   // definition and the revision of the configuration.
+   bool hasGeneration( uint64_t generation, unsigned configRevision ) const;
+   void clear();
+};
+
+}   // namespace argumentum
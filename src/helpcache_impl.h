@@ -0,0 +1,77 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "helpcache.h"
+
+#include <algorithm>
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE bool HelpCache::Key::operator==( const Key& other ) const
+{
+   return generation == other.generation && configRevision == other.configRevision
+         && textWidth == other.textWidth && argumentIndent == other.argumentIndent
+         && maxDescriptionIndent == other.maxDescriptionIndent;
+}
+
+ARGUMENTUM_INLINE HelpCache::HelpCache( const HelpCache& )
+{}
+
+ARGUMENTUM_INLINE HelpCache& HelpCache::operator=( const HelpCache& other )
+{
+   if ( this != &other )
+      clear();
+   return *this;
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<const std::string> HelpCache::find( const Key& key ) const
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   auto it = std::find_if(
+         mEntries.begin(), mEntries.end(), [&]( auto& entry ) { return entry.key == key; } );
+   return it != mEntries.end() ? it->pText : nullptr;
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<const std::string> HelpCache::store(
+      const Key& key, std::string text )
+{
+   auto pText = std::make_shared<const std::string>( std::move( text ) );
+
+   std::lock_guard<std::mutex> lock( mMutex );
+   auto it = std::find_if(
+         mEntries.begin(), mEntries.end(), [&]( auto& entry ) { return entry.key == key; } );
+   if ( it != mEntries.end() ) {
+      it->pText = pText;
+      return pText;
+   }
+
+   // The texts for older generations will not be requested again.
+   mEntries.erase( std::remove_if( mEntries.begin(), mEntries.end(),
+                         [&]( auto& entry ) {
+                            return entry.key.generation != key.generation
+                                  || entry.key.configRevision != key.configRevision;
+                         } ),
+         mEntries.end() );
+   if ( mEntries.size() >= maxEntries )
+      mEntries.erase( mEntries.begin() );
+   mEntries.push_back( { key, pText } );
+   return pText;
+}
+
+ARGUMENTUM_INLINE bool HelpCache::hasGeneration( uint64_t generation, unsigned configRevision ) const
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   return std::any_of( mEntries.begin(), mEntries.end(), [&]( auto& entry ) {
+      return entry.key.generation == generation && entry.key.configRevision == configRevision;
+   } );
+}
+
+ARGUMENTUM_INLINE void HelpCache::clear()
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   mEntries.clear();
+}
+
+}   // namespace argumentum
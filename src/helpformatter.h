@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "helpcache.h"
 #include "iformathelp.h"
 
 #include <algorithm>
@@ -28,7 +29,11 @@ class HelpFormatter : public IFormatHelp
    size_t mMaxDescriptionIndent = 30;
 
 public:
+   // The help is rendered once for each generation of the definition and
+   // each combination of the settings of the formatter.  It is kept in the
+   // help cache of the definition.
    void format( const ParserDefinition& parserDef, std::ostream& out ) override;
+   void prepare( const ParserDefinition& parserDef ) override;
 
    void setTextWidth( size_t widthBytes )
    {
@@ -41,6 +46,9 @@ public:
    }
 
 private:
+   HelpCache::Key getCacheKey( const ParserDefinition& parserDef ) const;
+   std::shared_ptr<const std::string> getHelp( const ParserDefinition& parserDef );
+   void render( const ParserDefinition& parserDef, std::ostream& out );
    void formatUsage(
          const ParserDefinition& parser, std::vector<ArgumentHelpResult>& args, Writer& writer );
    std::string formatArgument( const ArgumentHelpResult& arg ) const;
@@ -35,15 +35,11 @@ ARGUMENTUM_INLINE std::string HelpFormatter::formatArgument( const ArgumentHelpR
 ARGUMENTUM_INLINE size_t HelpFormatter::deriveMaxArgumentWidth(
       const std::vector<ArgumentHelpResult>& args ) const
 {
-   if ( args.empty() )
-      return 0U;
+   size_t width = 0;
+   for ( auto& arg : args )
+      width = std::max( width, formatArgument( arg ).size() );
 
-   auto imax =
-         std::max_element( std::begin( args ), std::end( args ), [this]( auto&& a, auto&& b ) {
-            return formatArgument( a ).size() < formatArgument( b ).size();
-         } );
-
-   return formatArgument( *imax ).size();
+   return width;
 }
 
 ARGUMENTUM_INLINE void HelpFormatter::formatUsage(
@@ -96,6 +92,42 @@ ARGUMENTUM_INLINE void HelpFormatter::formatUsage(
 }
 
 ARGUMENTUM_INLINE void HelpFormatter::format( const ParserDefinition& parserDef, std::ostream& out )
+{
+   out << *getHelp( parserDef );
+}
+
+ARGUMENTUM_INLINE void HelpFormatter::prepare( const ParserDefinition& parserDef )
+{
+   getHelp( parserDef );
+}
+
+ARGUMENTUM_INLINE HelpCache::Key HelpFormatter::getCacheKey(
+      const ParserDefinition& parserDef ) const
+{
+   HelpCache::Key key;
+   key.generation = parserDef.getGeneration();
+   key.configRevision = parserDef.getConfig().help_revision();
+   key.textWidth = mTextWidth;
+   key.argumentIndent = mArgumentIndent;
+   key.maxDescriptionIndent = mMaxDescriptionIndent;
+   return key;
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<const std::string> HelpFormatter::getHelp(
+      const ParserDefinition& parserDef )
+{
+   auto& cache = parserDef.getHelpCache();
+   auto key = getCacheKey( parserDef );
+   auto pHelp = cache.find( key );
+   if ( pHelp )
+      return pHelp;
+
+   std::ostringstream out;
+   render( parserDef, out );
+   return cache.store( key, out.str() );
+}
+
+ARGUMENTUM_INLINE void HelpFormatter::render( const ParserDefinition& parserDef, std::ostream& out )
 {
    const auto& config = parserDef.getConfig();
    ArgumentDescriber describer;
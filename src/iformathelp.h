@@ -44,6 +44,11 @@ class IFormatHelp
 {
 public:
    virtual void format( const ParserDefinition& parserDef, std::ostream& out ) = 0;
+
+   // Called when the definition is verified if the help should be rendered
+   // in advance.  A formatter that does not cache the help does nothing.
+   virtual void prepare( const ParserDefinition& /*parserDef*/ )
+   {}
 };
 
 }   // namespace argumentum
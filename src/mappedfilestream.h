@@ -0,0 +1,96 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "argumentstream.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#if __has_include( <sys/mman.h> ) && __has_include( <unistd.h> )
+#define ARGUMENTUM_HAVE_MMAP 1
+#else
+#define ARGUMENTUM_HAVE_MMAP 0
+#endif
+
+namespace argumentum {
+
+/**
+ * A file that is mapped into memory for sequential reading.  The pages that
+ * were already read can be released so that files larger than the available
+ * memory can be read.
+ */
+class MappedFile
+{
+   const char* mpData = nullptr;
+   size_t mSize = 0;
+
+   // The start of the mapping that has not been released, yet.
+   size_t mRetained = 0;
+
+public:
+   // The number of bytes that are read before the pages are released.
+   static constexpr size_t releaseChunkSize = size_t( 64 ) << 20;
+
+   // The smallest file that is worth mapping.  Reading a smaller file through
+   // a stream was measured to be faster (bench/responsefile_b.cpp).
+   static constexpr size_t minMappedSize = size_t( 64 ) << 10;
+
+public:
+   // Map the file @p filename.  Returns nullptr if the file can not be mapped
+   // or if it is smaller than @p minSize bytes.
+   static std::unique_ptr<MappedFile> open( const std::string& filename, size_t minSize = 0 );
+
+   MappedFile( const MappedFile& ) = delete;
+   MappedFile& operator=( const MappedFile& ) = delete;
+   ~MappedFile();
+
+   const char* data() const
+   {
+      return mpData;
+   }
+
+   size_t size() const
+   {
+      return mSize;
+   }
+
+   // Release the pages before @p pos when at least releaseChunkSize bytes
+   // were read since the last release.  The released pages are read from the
+   // file again if they are accessed.
+   void releaseBefore( size_t pos );
+
+private:
+   MappedFile( const char* pData, size_t size );
+};
+
+/**
+ * An implementation of ArgumentStream that reads arguments from a memory
+ * mapped file, one argument per line.  The returned views point directly into
+ * the mapping so the arguments are not copied.  A returned view is valid until
+ * the next call to next().
+ */
+class MappedFileArgumentStream : public ArgumentStream
+{
+   std::unique_ptr<MappedFile> mpFile;
+   size_t mPos = 0;
+
+public:
+   // Map the file @p filename.  Returns nullptr if the file can not be mapped
+   // or if it is smaller than @p minSize bytes.
+   static std::unique_ptr<MappedFileArgumentStream> open(
+         const std::string& filename, size_t minSize = 0 );
+
+   explicit MappedFileArgumentStream( std::unique_ptr<MappedFile> pFile );
+
+   std::optional<std::string_view> next() override;
+   void peek( std::function<EPeekResult( std::string_view )> fnPeek ) override;
+
+private:
+   // Returns the end of the line that starts at @p pos.
+   size_t findLineEnd( size_t pos ) const;
+};
+
+}   // namespace argumentum
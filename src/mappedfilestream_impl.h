@@ -0,0 +1,141 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "mappedfilestream.h"
+
+#include <cstring>
+
+#if ARGUMENTUM_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE std::unique_ptr<MappedFile> MappedFile::open(
+      const std::string& filename, size_t minSize )
+{
+#if ARGUMENTUM_HAVE_MMAP
+   auto fd = ::open( filename.c_str(), O_RDONLY );
+   if ( fd < 0 )
+      return nullptr;
+
+   struct stat st;
+   if ( ::fstat( fd, &st ) != 0 || !S_ISREG( st.st_mode ) ) {
+      ::close( fd );
+      return nullptr;
+   }
+
+   auto size = static_cast<size_t>( st.st_size );
+   if ( size < minSize ) {
+      ::close( fd );
+      return nullptr;
+   }
+
+   if ( size == 0 ) {
+      ::close( fd );
+      return std::unique_ptr<MappedFile>( new MappedFile( nullptr, 0 ) );
+   }
+
+   auto pData = ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+   // The mapping stays valid after the descriptor is closed.
+   ::close( fd );
+   if ( pData == MAP_FAILED )
+      return nullptr;
+
+   ::madvise( pData, size, MADV_SEQUENTIAL );
+   return std::unique_ptr<MappedFile>( new MappedFile( static_cast<const char*>( pData ), size ) );
+#else
+   (void)filename;
+   (void)minSize;
+   return nullptr;
+#endif
+}
+
+ARGUMENTUM_INLINE MappedFile::MappedFile( const char* pData, size_t size )
+   : mpData( pData )
+   , mSize( size )
+{}
+
+ARGUMENTUM_INLINE MappedFile::~MappedFile()
+{
+#if ARGUMENTUM_HAVE_MMAP
+   if ( mpData )
+      ::munmap( const_cast<char*>( mpData ), mSize );
+#endif
+}
+
+ARGUMENTUM_INLINE void MappedFile::releaseBefore( size_t pos )
+{
+#if ARGUMENTUM_HAVE_MMAP
+   if ( pos < mRetained || pos - mRetained < releaseChunkSize )
+      return;
+
+   auto pageSize = static_cast<size_t>( ::sysconf( _SC_PAGESIZE ) );
+   auto end = pos - pos % pageSize;
+   ::madvise( const_cast<char*>( mpData ) + mRetained, end - mRetained, MADV_DONTNEED );
+   mRetained = end;
+#else
+   (void)pos;
+#endif
+}
+
+ARGUMENTUM_INLINE std::unique_ptr<MappedFileArgumentStream> MappedFileArgumentStream::open(
+      const std::string& filename, size_t minSize )
+{
+   auto pFile = MappedFile::open( filename, minSize );
+   if ( !pFile )
+      return nullptr;
+
+   return std::make_unique<MappedFileArgumentStream>( std::move( pFile ) );
+}
+
+ARGUMENTUM_INLINE MappedFileArgumentStream::MappedFileArgumentStream(
+      std::unique_ptr<MappedFile> pFile )
+   : mpFile( std::move( pFile ) )
+{}
+
+ARGUMENTUM_INLINE std::optional<std::string_view> MappedFileArgumentStream::next()
+{
+   // Like std::getline, a line is not returned if the file ends before it
+   // starts.
+   if ( !mpFile || mPos >= mpFile->size() )
+      return {};
+
+   // The view returned by the previous call to next() is no longer used.
+   mpFile->releaseBefore( mPos );
+
+   auto start = mPos;
+   auto end = findLineEnd( start );
+   mPos = end < mpFile->size() ? end + 1 : end;
+   return std::string_view( mpFile->data() + start, end - start );
+}
+
+ARGUMENTUM_INLINE void MappedFileArgumentStream::peek(
+      std::function<EPeekResult( std::string_view )> fnPeek )
+{
+   if ( !fnPeek || !mpFile )
+      return;
+
+   for ( auto pos = mPos; pos < mpFile->size(); ) {
+      auto end = findLineEnd( pos );
+      if ( fnPeek( std::string_view( mpFile->data() + pos, end - pos ) ) == peekDone )
+         break;
+      pos = end + 1;
+   }
+}
+
+ARGUMENTUM_INLINE size_t MappedFileArgumentStream::findLineEnd( size_t pos ) const
+{
+   // memchr is vectorized in the common C libraries.
+   auto pData = mpFile->data();
+   auto size = mpFile->size();
+   auto pEnd = static_cast<const char*>( std::memchr( pData + pos, '\n', size - pos ) );
+   return pEnd ? static_cast<size_t>( pEnd - pData ) : size;
+}
+
+}   // namespace argumentum
@@ -0,0 +1,50 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "completiontrie.h"
+#include "editindex.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace argumentum {
+
+class ParserDefinition;
+
+/**
+ * Keeps the indices of the names in a parser definition that are used for
+ * completion and for the suggestions for unknown options.  An index is built
+ * once for a generation of the definition and shared read-only by all the
+ * contexts that parse with the definition, so a new parse session does not
+ * build it again.  The cache can be used by multiple threads.
+ */
+class NameIndexCache
+{
+   mutable std::mutex mMutex;
+   std::shared_ptr<const CompletionTrie> mpTrie;
+   std::shared_ptr<const EditIndex> mpEditIndex;
+   uint64_t mTrieGeneration = 0;
+   uint64_t mIndexGeneration = 0;
+
+public:
+   NameIndexCache() = default;
+
+   // A copied or moved definition starts with an empty cache.
+   NameIndexCache( const NameIndexCache& );
+   NameIndexCache& operator=( const NameIndexCache& );
+
+   // Get the trie of the option and command names for the current generation
+   // of @p parserDef.  The trie is built on the first request.
+   std::shared_ptr<const CompletionTrie> getCompletionTrie( const ParserDefinition& parserDef );
+
+   // Get the index of the option names for the current generation of
+   // @p parserDef.  The index is built on the first request.
+   std::shared_ptr<const EditIndex> getEditIndex( const ParserDefinition& parserDef );
+
+   void clear();
+};
+
+}   // namespace argumentum
@@ -0,0 +1,59 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "nameindexcache.h"
+
+#include "parserdefinition.h"
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE NameIndexCache::NameIndexCache( const NameIndexCache& )
+{}
+
+ARGUMENTUM_INLINE NameIndexCache& NameIndexCache::operator=( const NameIndexCache& other )
+{
+   if ( this != &other )
+      clear();
+   return *this;
+}
+
+// The index is built while the mutex is held so that the threads that need
+// it at the same time build it only once.
+ARGUMENTUM_INLINE std::shared_ptr<const CompletionTrie> NameIndexCache::getCompletionTrie(
+      const ParserDefinition& parserDef )
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   if ( !mpTrie || mTrieGeneration != parserDef.getGeneration() ) {
+      auto pTrie = std::make_shared<CompletionTrie>();
+      pTrie->build( parserDef );
+      mpTrie = std::move( pTrie );
+      mTrieGeneration = parserDef.getGeneration();
+   }
+
+   return mpTrie;
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<const EditIndex> NameIndexCache::getEditIndex(
+      const ParserDefinition& parserDef )
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   if ( !mpEditIndex || mIndexGeneration != parserDef.getGeneration() ) {
+      auto pIndex = std::make_shared<EditIndex>();
+      pIndex->build( parserDef );
+      mpEditIndex = std::move( pIndex );
+      mIndexGeneration = parserDef.getGeneration();
+   }
+
+   return mpEditIndex;
+}
+
+ARGUMENTUM_INLINE void NameIndexCache::clear()
+{
+   std::lock_guard<std::mutex> lock( mMutex );
+   mpTrie.reset();
+   mpEditIndex.reset();
+}
+
+}   // namespace argumentum
@@ -14,17 +14,20 @@
 namespace argumentum {
 
 class OptionGroup;
+class ParseContext;
 
 class Option
 {
    friend class OptionFactory;
+   friend class ParseContext;
+   friend class ParserDefinition;
 
 public:
    enum Kind { singleValue, vectorValue };
 
 private:
    std::shared_ptr<Value> mpValue;
-   AssignAction mAssignAction;
+   AssignViewAction mAssignAction;
    AssignDefaultAction mAssignDefaultAction;
    std::string mShortName;
    std::string mLongName;
@@ -32,6 +35,10 @@ private:
    std::string mHelp;
    std::string mFlagValue = "1";
    std::vector<std::string> mChoices;
+
+   // The environment variable that is read when the option is not in the
+   // input arguments.
+   std::string mEnvVariable;
    std::shared_ptr<OptionGroup> mpGroup;
    int mMinArgs = 0;
    int mMaxArgs = 0;
@@ -41,12 +48,11 @@ private:
    // The parameter of this option is forwarded.  The parameter is defined after a comma.
    bool mIsForwarded = false;
 
-   // The number of asignments through the option that is currently active in
-   // the parser.
-   int mCurrentAssignCount = 0;
-
-   // The total number of assignments through this option.
-   int mTotalAssignCount = 0;
+   // The positions of the state of the option and of its value in a
+   // ParseContext.  Options that share a value have the same value slot.  The
+   // slots are assigned by ParserDefinition::assignSlots.
+   size_t mSlot = 0;
+   size_t mValueSlot = 0;
 
 public:
    void setShortName( std::string_view name );
@@ -59,10 +65,11 @@ public:
    void setRequired( bool isRequired = true );
    void setFlagValue( std::string_view value );
    void setChoices( const std::vector<std::string>& choices );
-   void setAction( AssignAction action );
+   void setAction( AssignViewAction action );
    void setAssignDefaultAction( AssignDefaultAction action );
    void setGroup( const std::shared_ptr<OptionGroup>& pGroup );
    void setForwarded( bool isForwarded = true );
+   void setEnvVariable( std::string_view name );
    bool isRequired() const;
    bool isPositional() const;
    bool isShortNumeric() const;
@@ -72,30 +79,35 @@ public:
    std::string getHelpName() const;
    bool hasName( std::string_view name ) const;
    const std::string& getRawHelp() const;
+   const std::vector<std::string>& getChoices() const;
    std::vector<std::string> getMetavar() const;
-   void setValue( std::string_view value, Environment& env );
-
-   /**
-    * Called when an option was started but no values followed.
-    */
-   void autoSetMissingValue( Environment& env );
-   void assignDefault();
    bool hasDefault() const;
-   void resetValue();
-   void onOptionStarted();
    bool acceptsAnyArguments() const;
-   bool willAcceptArgument() const;
-   bool needsMoreArguments() const;
    bool hasVectorValue() const;
    bool isForwarded() const;
+   const std::string& getEnvVariable() const;
+
+   // The state of parsing is kept in a ParseContext so that the option can be
+   // used by multiple parsers at the same time.
+   void setValue( std::string_view value, ParseContext& context, Environment& env ) const;
+
+   /**
+    * Called when an option was started but no values followed.
+    */
+   void autoSetMissingValue( ParseContext& context, Environment& env ) const;
+   void assignDefault( ParseContext& context ) const;
+   void reserveValues( ParseContext& context, size_t count ) const;
+   void onOptionStarted( ParseContext& context ) const;
+   bool willAcceptArgument( const ParseContext& context ) const;
+   bool needsMoreArguments( const ParseContext& context ) const;
 
    /**
     * @returns true if the value was assigned through any option that shares
     * this option's value.
     */
-   bool wasAssigned() const;
+   bool wasAssigned( const ParseContext& context ) const;
 
-   bool wasAssignedThroughThisOption() const;
+   bool wasAssignedThroughThisOption( const ParseContext& context ) const;
    const std::string& getFlagValue() const;
    std::tuple<int, int> getArgumentCounts() const;
    std::shared_ptr<OptionGroup> getGroup() const;
@@ -7,6 +7,7 @@
 
 #include "exceptions.h"
 #include "group.h"
+#include "parsecontext.h"
 
 #include <cstdarg>
 
@@ -89,7 +90,7 @@ ARGUMENTUM_INLINE void Option::setChoices( const std::vector<std::string>& choic
    mChoices = choices;
 }
 
-ARGUMENTUM_INLINE void Option::setAction( AssignAction action )
+ARGUMENTUM_INLINE void Option::setAction( AssignViewAction action )
 {
    mAssignAction = action;
 }
@@ -114,6 +115,16 @@ ARGUMENTUM_INLINE bool Option::isForwarded() const
    return mIsForwarded;
 }
 
+ARGUMENTUM_INLINE void Option::setEnvVariable( std::string_view name )
+{
+   mEnvVariable = name;
+}
+
+ARGUMENTUM_INLINE const std::string& Option::getEnvVariable() const
+{
+   return mEnvVariable;
+}
+
 ARGUMENTUM_INLINE bool Option::isRequired() const
 {
    return mIsRequired;
@@ -181,35 +192,39 @@ ARGUMENTUM_INLINE std::vector<std::string> Option::getMetavar() const
    return { metavar };
 }
 
-ARGUMENTUM_INLINE void Option::setValue( std::string_view value, Environment& env )
+ARGUMENTUM_INLINE void Option::setValue(
+      std::string_view value, ParseContext& context, Environment& env ) const
 {
-   ++mCurrentAssignCount;
-   ++mTotalAssignCount;
+   auto& state = context.getOptionState( *this );
+   ++state.currentAssignCount;
+   ++state.totalAssignCount;
 
-   if ( !mChoices.empty() && std::none_of( mChoices.begin(), mChoices.end(), [&value]( auto v ) {
+   auto& target = context.getValue( *this );
+   if ( !mChoices.empty() && std::none_of( mChoices.begin(), mChoices.end(), [&value]( const auto& v ) {
            return v == value;
         } ) ) {
-      mpValue->markBadArgument();
+      target.markBadArgument();
       throw InvalidChoiceError( value );
    }
 
-   // If mAssignAction is not set, mpValue->setValue will try to use a default
+   // If mAssignAction is not set, target.setValue will try to use a default
    // action.
-   mpValue->setValue( value, mAssignAction, env );
+   target.setValue( value, mAssignAction, env );
 }
 
-ARGUMENTUM_INLINE void Option::autoSetMissingValue( Environment& env )
+ARGUMENTUM_INLINE void Option::autoSetMissingValue( ParseContext& context, Environment& env ) const
 {
-   ++mCurrentAssignCount;
-   ++mTotalAssignCount;
+   auto& state = context.getOptionState( *this );
+   ++state.currentAssignCount;
+   ++state.totalAssignCount;
 
-   mpValue->setMissingValue( getFlagValue(), env );
+   context.getValue( *this ).setMissingValue( getFlagValue(), env );
 }
 
-ARGUMENTUM_INLINE void Option::assignDefault()
+ARGUMENTUM_INLINE void Option::assignDefault( ParseContext& context ) const
 {
    if ( mAssignDefaultAction )
-      mpValue->setDefault( mAssignDefaultAction );
+      context.getValue( *this ).setDefault( mAssignDefaultAction );
 }
 
 ARGUMENTUM_INLINE bool Option::hasDefault() const
@@ -217,17 +232,20 @@ ARGUMENTUM_INLINE bool Option::hasDefault() const
    return mAssignDefaultAction != nullptr;
 }
 
-ARGUMENTUM_INLINE void Option::resetValue()
+ARGUMENTUM_INLINE void Option::reserveValues( ParseContext& context, size_t count ) const
+{
+   context.getValue( *this ).reserve( count );
+}
+
+ARGUMENTUM_INLINE void Option::onOptionStarted( ParseContext& context ) const
 {
-   mCurrentAssignCount = 0;
-   mTotalAssignCount = 0;
-   mpValue->reset();
+   context.getOptionState( *this ).currentAssignCount = 0;
+   context.getValue( *this ).onOptionStarted();
 }
 
-ARGUMENTUM_INLINE void Option::onOptionStarted()
+ARGUMENTUM_INLINE const std::vector<std::string>& Option::getChoices() const
 {
-   mCurrentAssignCount = 0;
-   mpValue->onOptionStarted();
+   return mChoices;
 }
 
 ARGUMENTUM_INLINE bool Option::acceptsAnyArguments() const
@@ -235,14 +253,14 @@ ARGUMENTUM_INLINE bool Option::acceptsAnyArguments() const
    return mMinArgs > 0 || mMaxArgs != 0;
 }
 
-ARGUMENTUM_INLINE bool Option::willAcceptArgument() const
+ARGUMENTUM_INLINE bool Option::willAcceptArgument( const ParseContext& context ) const
 {
-   return mMaxArgs < 0 || mCurrentAssignCount < mMaxArgs;
+   return mMaxArgs < 0 || context.getOptionState( *this ).currentAssignCount < mMaxArgs;
 }
 
-ARGUMENTUM_INLINE bool Option::needsMoreArguments() const
+ARGUMENTUM_INLINE bool Option::needsMoreArguments( const ParseContext& context ) const
 {
-   return mCurrentAssignCount < mMinArgs;
+   return context.getOptionState( *this ).currentAssignCount < mMinArgs;
 }
 
 ARGUMENTUM_INLINE bool Option::hasVectorValue() const
@@ -250,14 +268,14 @@ ARGUMENTUM_INLINE bool Option::hasVectorValue() const
    return mIsVectorValue;
 }
 
-ARGUMENTUM_INLINE bool Option::wasAssigned() const
+ARGUMENTUM_INLINE bool Option::wasAssigned( const ParseContext& context ) const
 {
-   return mpValue->getAssignCount() > 0;
+   return context.getValue( *this ).getAssignCount() > 0;
 }
 
-ARGUMENTUM_INLINE bool Option::wasAssignedThroughThisOption() const
+ARGUMENTUM_INLINE bool Option::wasAssignedThroughThisOption( const ParseContext& context ) const
 {
-   return mTotalAssignCount > 0;
+   return context.getOptionState( *this ).totalAssignCount > 0;
 }
 
 ARGUMENTUM_INLINE const std::string& Option::getFlagValue() const
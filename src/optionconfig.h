@@ -5,9 +5,13 @@
 
 #include "option.h"
 
+#include <string_view>
+#include <type_traits>
+
 namespace argumentum {
 
 class ParameterConfig;
+class ParserDefinition;
 
 /**
  * OptionConfig is used to configure an option after an option was created with add_argument.
@@ -18,17 +22,25 @@ class OptionConfig
 
 private:
    std::shared_ptr<Option> mpOption;
+   // The definition that holds the option.  It is notified when the names,
+   // the parse properties or the help of the option change.
+   ParserDefinition* mpParserDef = nullptr;
    bool mCountWasSet = false;
 
 protected:
    OptionConfig( const OptionConfig& ) = default;
    OptionConfig( OptionConfig&& ) = default;
    OptionConfig( const std::shared_ptr<Option>& pOption );
+   OptionConfig( const std::shared_ptr<Option>& pOption, ParserDefinition& parserDef );
 
    Option& getOption() const;
+   void notifyNamesChanged();
+   void notifyPropertiesChanged();
+   void notifyHelpChanged();
    void markCountWasSet();
    void ensureCountWasNotSet() const;
    void ensureCanBeForwarded() const;
+   static void ensureValidEnvVariable( std::string_view variable );
 };
 
 template<typename TDerived>
@@ -43,12 +55,14 @@ public:
    this_t& setShortName( std::string_view name )
    {
       getOption().setShortName( name );
+      notifyNamesChanged();
       return *static_cast<this_t*>( this );
    }
 
    this_t& setLongName( std::string_view name )
    {
       getOption().setLongName( name );
+      notifyNamesChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -59,6 +73,7 @@ public:
    this_t& metavar( std::string_view varname )
    {
       getOption().setMetavar( { varname } );
+      notifyHelpChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -69,6 +84,7 @@ public:
    this_t& metavar( const std::vector<std::string_view>& varnames )
    {
       getOption().setMetavar( varnames );
+      notifyHelpChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -77,6 +93,7 @@ public:
    this_t& help( std::string_view help )
    {
       getOption().setHelp( help );
+      notifyHelpChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -86,6 +103,7 @@ public:
       ensureCountWasNotSet();
       getOption().setNArgs( count );
       markCountWasSet();
+      notifyPropertiesChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -95,6 +113,7 @@ public:
       ensureCountWasNotSet();
       getOption().setMinArgs( count );
       markCountWasSet();
+      notifyPropertiesChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -104,6 +123,7 @@ public:
       ensureCountWasNotSet();
       getOption().setMaxArgs( count );
       markCountWasSet();
+      notifyPropertiesChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -111,6 +131,7 @@ public:
    this_t& required( bool isRequired = true )
    {
       getOption().setRequired( isRequired );
+      notifyPropertiesChanged();
       return *static_cast<this_t*>( this );
    }
 
@@ -148,6 +169,23 @@ public:
       return *static_cast<this_t*>( this );
    }
 
+   // Read the value of the option from the environment variable @p variable
+   // when the option is not in the input arguments.  The value of the
+   // variable is assigned like a single argument of the option and the
+   // default value is used only when the variable is not set.  An empty name
+   // removes the variable.
+   //
+   // @example Read the log level from APP_LOG_LEVEL.
+   //
+   //    params.add_parameter( level, "--log-level" ).nargs( 1 ).env( "APP_LOG_LEVEL" );
+   this_t& env( std::string_view variable )
+   {
+      ensureValidEnvVariable( variable );
+      getOption().setEnvVariable( variable );
+      notifyPropertiesChanged();
+      return *static_cast<this_t*>( this );
+   }
+
 protected:
    using OptionConfig::OptionConfig;
 
@@ -177,12 +215,9 @@ public:
    this_t& action( assign_action_t action )
    {
       if ( action ) {
-         auto wrapAction = [=]( Value& value, const std::string& argument, Environment& ) {
-            auto pConverted = ConvertedValue<TTarget>::value_cast( value );
-            if ( pConverted )
-               action( pConverted->mTarget, argument );
-         };
-         OptionConfig::getOption().setAction( wrapAction );
+         setViewAction( [=]( TTarget& target, std::string_view argument, Environment& ) {
+            action( target, std::string{ argument } );
+         } );
       }
       else
          OptionConfig::getOption().setAction( nullptr );
@@ -196,18 +231,40 @@ public:
    this_t& action( assign_action_env_t action )
    {
       if ( action ) {
-         auto wrapAction = [=]( Value& value, const std::string& argument, Environment& env ) {
-            auto pConverted = ConvertedValue<TTarget>::value_cast( value );
-            if ( pConverted )
-               action( pConverted->mTarget, argument, env );
-         };
-         OptionConfig::getOption().setAction( wrapAction );
+         setViewAction( [=]( TTarget& target, std::string_view argument, Environment& env ) {
+            action( target, std::string{ argument }, env );
+         } );
       }
       else
          OptionConfig::getOption().setAction( nullptr );
       return *this;
    }
 
+   // Define an action that receives the argument as a std::string_view.  The
+   // argument is not copied before the action is executed.
+   template<typename TAction,
+         std::enable_if_t<std::is_invocable_v<TAction&, TTarget&, std::string_view>, int> = 0>
+   this_t& action( TAction action )
+   {
+      setViewAction( [=]( TTarget& target, std::string_view argument, Environment& ) {
+         action( target, argument );
+      } );
+      return *this;
+   }
+
+   // Define an action that receives the argument as a std::string_view and has
+   // access to the parsing environment.
+   template<typename TAction,
+         std::enable_if_t<
+               std::is_invocable_v<TAction&, TTarget&, std::string_view, Environment&>, int> = 0>
+   this_t& action( TAction action )
+   {
+      setViewAction( [=]( TTarget& target, std::string_view argument, Environment& env ) {
+         action( target, argument, env );
+      } );
+      return *this;
+   }
+
    // Define the value that will be assigned to the target if the option is
    // not present in arguments.  If multiple options that are configured with
    // default_value() have the same target, the result is undefined.
@@ -219,6 +276,7 @@ public:
             pConverted->mTarget = defaultValue;
       };
       OptionConfig::getOption().setAssignDefaultAction( wrapDefault );
+      OptionConfig::notifyPropertiesChanged();
       return *this;
    }
 
@@ -233,6 +291,7 @@ public:
             action( pConverted->mTarget );
       };
       OptionConfig::getOption().setAssignDefaultAction( wrapDefault );
+      OptionConfig::notifyPropertiesChanged();
       return *this;
    }
 
@@ -250,6 +309,19 @@ public:
    {
       return default_value( action );
    }
+
+private:
+   template<typename TAction>
+   void setViewAction( TAction&& action )
+   {
+      auto wrapAction = [action = std::forward<TAction>( action )](
+                              Value& value, std::string_view argument, Environment& env ) {
+         auto pConverted = ConvertedValue<TTarget>::value_cast( value );
+         if ( pConverted )
+            action( pConverted->mTarget, argument, env );
+      };
+      OptionConfig::getOption().setAction( wrapAction );
+   }
 };
 
 class VoidOptionConfig final : public OptionConfigBaseT<VoidOptionConfig>
@@ -265,6 +337,21 @@ public:
    // The action is executed instead of the default assignment action and can
    // set the value of the target variable associated with the option.
    VoidOptionConfig& action( assign_action_env_t action );
+
+   // Define an action that receives the argument as a std::string_view.  The
+   // argument is not copied before the action is executed.
+   template<typename TAction,
+         std::enable_if_t<std::is_invocable_v<TAction&, std::string_view, Environment&>, int> = 0>
+   VoidOptionConfig& action( TAction action )
+   {
+      auto wrapAction = [=]( Value& value, std::string_view argument, Environment& env ) {
+         auto pVoid = VoidValue::value_cast( value );
+         if ( pVoid )
+            action( argument, env );
+      };
+      OptionConfig::getOption().setAction( wrapAction );
+      return *this;
+   }
 };
 
 }   // namespace argumentum
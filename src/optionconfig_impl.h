@@ -5,6 +5,8 @@
 
 #include "optionconfig.h"
 
+#include "parserdefinition.h"
+
 #include <cassert>
 
 namespace argumentum {
@@ -17,11 +19,36 @@ ARGUMENTUM_INLINE OptionConfig::OptionConfig( const std::shared_ptr<Option>& pOp
       throw std::invalid_argument( "OptionConfig requires an option." );
 }
 
+ARGUMENTUM_INLINE OptionConfig::OptionConfig(
+      const std::shared_ptr<Option>& pOption, ParserDefinition& parserDef )
+   : OptionConfig( pOption )
+{
+   mpParserDef = &parserDef;
+}
+
 ARGUMENTUM_INLINE Option& OptionConfig::getOption() const
 {
    return *mpOption;
 }
 
+ARGUMENTUM_INLINE void OptionConfig::notifyNamesChanged()
+{
+   if ( mpParserDef )
+      mpParserDef->invalidateIndex();
+}
+
+ARGUMENTUM_INLINE void OptionConfig::notifyPropertiesChanged()
+{
+   if ( mpParserDef )
+      mpParserDef->invalidateOptionTable();
+}
+
+ARGUMENTUM_INLINE void OptionConfig::notifyHelpChanged()
+{
+   if ( mpParserDef )
+      mpParserDef->markChanged();
+}
+
 ARGUMENTUM_INLINE void OptionConfig::markCountWasSet()
 {
    mCountWasSet = true;
@@ -39,6 +66,12 @@ ARGUMENTUM_INLINE void OptionConfig::ensureCanBeForwarded() const
       throw std::invalid_argument( "Only long options can be used for forwarding parameters." );
 }
 
+ARGUMENTUM_INLINE void OptionConfig::ensureValidEnvVariable( std::string_view variable )
+{
+   if ( variable.find( '=' ) != std::string_view::npos )
+      throw std::invalid_argument( "The name of an environment variable can not contain '='." );
+}
+
 ARGUMENTUM_INLINE VoidOptionConfig::VoidOptionConfig( OptionConfig&& wrapped )
    : OptionConfigBaseT<VoidOptionConfig>( std::move( wrapped ) )
 {}
@@ -46,12 +79,10 @@ ARGUMENTUM_INLINE VoidOptionConfig::VoidOptionConfig( OptionConfig&& wrapped )
 ARGUMENTUM_INLINE VoidOptionConfig& VoidOptionConfig::action( assign_action_env_t action )
 {
    if ( action ) {
-      auto wrapAction = [=]( Value& value, const std::string& argument,
-                              Environment& env ) -> std::optional<std::string> {
+      auto wrapAction = [=]( Value& value, std::string_view argument, Environment& env ) {
          auto pVoid = VoidValue::value_cast( value );
          if ( pVoid )
-            action( argument, env );
-         return {};
+            action( std::string{ argument }, env );
       };
       OptionConfig::getOption().setAction( wrapAction );
    }
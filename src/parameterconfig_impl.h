@@ -34,6 +34,16 @@ ARGUMENTUM_INLINE CommandConfig ParameterConfig::add_command(
    return tryAddCommand( command );
 }
 
+ARGUMENTUM_INLINE CommandConfig ParameterConfig::add_command(
+      const std::string& name, Command::options_factory_t factory )
+{
+   if ( !factory )
+      throw MissingCommandOptions( name );
+
+   auto command = Command( name, std::move( factory ) );
+   return tryAddCommand( command );
+}
+
 ARGUMENTUM_INLINE void ParameterConfig::add_parameters( std::shared_ptr<Options> pOptions )
 {
    if ( pOptions )
@@ -100,7 +110,7 @@ ARGUMENTUM_INLINE GroupConfig ParameterConfig::add_group( const std::string& nam
    else
       mParserDef.mpActiveGroup = addGroup( name, false );
 
-   return GroupConfig( mParserDef.mpActiveGroup );
+   return GroupConfig( mParserDef.mpActiveGroup, mParserDef );
 }
 
 ARGUMENTUM_INLINE GroupConfig ParameterConfig::add_exclusive_group( const std::string& name )
@@ -114,7 +124,7 @@ ARGUMENTUM_INLINE GroupConfig ParameterConfig::add_exclusive_group( const std::s
    else
       mParserDef.mpActiveGroup = addGroup( name, true );
 
-   return GroupConfig( mParserDef.mpActiveGroup );
+   return GroupConfig( mParserDef.mpActiveGroup, mParserDef );
 }
 
 ARGUMENTUM_INLINE void ParameterConfig::end_group()
@@ -179,13 +189,18 @@ ARGUMENTUM_INLINE OptionConfig ParameterConfig::addPositional(
       option.setGroup( mParserDef.mpActiveGroup );
 
    mParserDef.mPositional.push_back( pOption );
-   return { pOption };
+   mParserDef.markChanged();
+   return { pOption, mParserDef };
 }
 
 ARGUMENTUM_INLINE OptionConfig ParameterConfig::addOption(
       Option&& newOption, const std::vector<std::string_view>& names )
 {
    trySetNames( newOption, names );
+
+   // The index is extended with every new option so that the duplicates are
+   // found in constant time.
+   mParserDef.buildNameIndex();
    ensureIsNewOption( newOption.getLongName() );
    ensureIsNewOption( newOption.getShortName() );
 
@@ -195,7 +210,9 @@ ARGUMENTUM_INLINE OptionConfig ParameterConfig::addOption(
       pOption->setGroup( mParserDef.mpActiveGroup );
 
    mParserDef.mOptions.push_back( pOption );
-   return { pOption };
+   mParserDef.indexLastOption();
+   mParserDef.markChanged();
+   return { pOption, mParserDef };
 }
 
 ARGUMENTUM_INLINE void ParameterConfig::trySetNames(
@@ -239,11 +256,14 @@ ARGUMENTUM_INLINE CommandConfig ParameterConfig::tryAddCommand( Command& command
    if ( command.getName()[0] == '-' )
       throw std::invalid_argument( "Command name must not start with a dash." );
 
+   mParserDef.buildNameIndex();
    ensureIsNewCommand( command.getName() );
 
    auto pCommand = std::make_shared<Command>( std::move( command ) );
    mParserDef.mCommands.push_back( pCommand );
-   return { pCommand };
+   mParserDef.indexLastCommand();
+   mParserDef.markChanged();
+   return { pCommand, mParserDef };
 }
 
 ARGUMENTUM_INLINE void ParameterConfig::ensureIsNewCommand( const std::string& name )
@@ -266,6 +286,7 @@ ARGUMENTUM_INLINE std::shared_ptr<OptionGroup> ParameterConfig::addGroup(
 
    auto pGroup = std::make_shared<OptionGroup>( name, isExclusive );
    mParserDef.mGroups[name] = pGroup;
+   mParserDef.markChanged();
    return pGroup;
 }
 
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "completiontrie.h"
+#include "editindex.h"
+#include "value.h"
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace argumentum {
+
+class Command;
+class CommandOptions;
+class Option;
+class ParserDefinition;
+class argument_parser;
+
+// The state of an option while the arguments are parsed.
+struct OptionState
+{
+   // The number of asignments through the option that is currently active in
+   // the parser.
+   int currentAssignCount = 0;
+
+   // The total number of assignments through this option.
+   int totalAssignCount = 0;
+};
+
+// A set of group indices.  The storage is reused between parses.
+class GroupSet
+{
+   std::vector<uint64_t> mWords;
+
+public:
+   // Remove all groups and make room for @p groupCount groups.
+   void reset( size_t groupCount );
+
+   // Returns false if the group was already in the set.
+   bool insert( size_t group );
+   bool contains( size_t group ) const;
+};
+
+/**
+ * The state of a single parse: the assignment counters of the options and the
+ * values that set the targets.  The parser definition is not modified while
+ * the arguments are parsed so multiple contexts can parse against the same
+ * definition at the same time.
+ *
+ * A context either uses the values of the definition or it has private copies
+ * of the values.  A private copy can be bound to a different target with a
+ * TargetBinding.
+ */
+class ParseContext
+{
+   std::vector<OptionState> mOptionStates;
+
+   // The values indexed by the value slots of the options.  They point to the
+   // values of the definition or to the values in mPrivateValues.
+   std::vector<Value*> mValues;
+   std::vector<std::unique_ptr<Value>> mPrivateValues;
+
+   // The slots of the option states and values that were changed since the
+   // last reset.  Only these are reset before the next parse.  Everything is
+   // reset before the first parse.  The values of the definition are listed in
+   // mSharedValues and reset before every parse.
+   std::vector<size_t> mTouchedOptions;
+   std::vector<size_t> mTouchedValues;
+   std::vector<uint8_t> mIsOptionTouched;
+   std::vector<uint8_t> mIsValueTouched;
+   std::vector<size_t> mSharedValues;
+   bool mNeedsFullReset = true;
+
+   // The groups that are marked while the parsed options are validated.
+   GroupSet mUsedGroups;
+   GroupSet mViolatedGroups;
+
+   // The options of a command that was selected in this context and the
+   // parser for them.
+   struct CommandState
+   {
+      std::shared_ptr<CommandOptions> pOptions;
+      std::shared_ptr<argument_parser> pParser;
+      unsigned factoryVersion = 0;
+   };
+   std::unordered_map<const Command*, CommandState> mCommands;
+
+   // The names that complete a word.  The trie is shared by the contexts
+   // that parse with the definition; the context keeps the trie of the last
+   // definition it used so that the cache is not locked for every lookup.
+   std::shared_ptr<const CompletionTrie> mpCompletionTrie;
+   const ParserDefinition* mpTrieDefinition = nullptr;
+   uint64_t mTrieGeneration = 0;
+
+   // The option names that are one edit away from an unknown option.  The
+   // index is shared like the trie.
+   std::shared_ptr<const EditIndex> mpEditIndex;
+   const ParserDefinition* mpIndexDefinition = nullptr;
+   uint64_t mIndexGeneration = 0;
+
+   // The scratch buffers for the names that are similar to an unknown option.
+   std::vector<CompletionTrie::Match> mSimilarNames;
+   std::vector<std::string_view> mSuggestions;
+
+   TargetBinding mBinding;
+   bool mHasPrivateValues = false;
+
+public:
+   // Create a context that uses the values of the definition.
+   ParseContext() = default;
+
+   // Create a context with private values bound to the targets selected by
+   // @p binding.
+   explicit ParseContext( const TargetBinding& binding );
+
+   /**
+    * Prepare the state for the options in @p parserDef.  The state is
+    * recreated only when options were added to the definition.
+    */
+   void prepare( const ParserDefinition& parserDef );
+
+   OptionState& getOptionState( const Option& option );
+   const OptionState& getOptionState( const Option& option ) const;
+   Value& getValue( const Option& option );
+   const Value& getValue( const Option& option ) const;
+
+   // Access the state by the slots in an OptionTable.
+   const OptionState& getOptionState( size_t slot ) const;
+   bool wasValueAssigned( size_t valueSlot ) const;
+
+   // The slots of the options and values that were changed since the last
+   // reset, in the order of the first change.
+   const std::vector<size_t>& getTouchedOptions() const;
+   const std::vector<size_t>& getTouchedValues() const;
+
+   /**
+    * Reset the states of the options and the values before the arguments are
+    * parsed.  The values of the definition are always reset because the
+    * program or another context may change their targets.  Only the private
+    * values that were changed since the last reset are reset.
+    */
+   void reset();
+
+   // Scratch sets for validating the groups.
+   GroupSet& getUsedGroups();
+   GroupSet& getViolatedGroups();
+
+   /**
+    * Get the options of the command.  A context with private values creates
+    * its own options if the command has a factory.
+    */
+   std::shared_ptr<CommandOptions> getCommandOptions( Command& command );
+
+   /**
+    * Get the slot for the parser of the command's options.  The slot is empty
+    * until the parser is built.  A context that uses the values of the
+    * definition caches the parser in the command.
+    */
+   std::shared_ptr<argument_parser>& getCommandParser( Command& command );
+
+   /**
+    * Get the trie of the option and command names in @p parserDef.  The trie
+    * is taken from the cache of the definition, where it is built when it is
+    * needed for the first time and rebuilt when the definition changes.
+    */
+   const CompletionTrie& getCompletionTrie( const ParserDefinition& parserDef );
+
+   /**
+    * Find at most three option names in @p parserDef that are similar to the
+    * unknown option @p name.  The names one edit away are found in an index.
+    * The trie is searched for the names two edits away only if there are none.
+    * Names with less than four characters after the dashes have no
+    * suggestions.  The result is valid until the next call.
+    */
+   const std::vector<std::string_view>& findSimilarOptions(
+         const ParserDefinition& parserDef, std::string_view name );
+
+private:
+   void addValue( const Option& option );
+   CommandState& getCommandState( const Command& command );
+};
+
+}   // namespace argumentum
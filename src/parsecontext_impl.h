@@ -0,0 +1,256 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "parsecontext.h"
+
+#include "command.h"
+#include "option.h"
+#include "parserdefinition.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE void GroupSet::reset( size_t groupCount )
+{
+   mWords.assign( ( groupCount + 63 ) / 64, 0 );
+}
+
+ARGUMENTUM_INLINE bool GroupSet::insert( size_t group )
+{
+   assert( group / 64 < mWords.size() );
+   auto& word = mWords[group / 64];
+   auto bit = uint64_t( 1 ) << ( group % 64 );
+   if ( word & bit )
+      return false;
+   word |= bit;
+   return true;
+}
+
+ARGUMENTUM_INLINE bool GroupSet::contains( size_t group ) const
+{
+   assert( group / 64 < mWords.size() );
+   return ( mWords[group / 64] & ( uint64_t( 1 ) << ( group % 64 ) ) ) != 0;
+}
+
+ARGUMENTUM_INLINE ParseContext::ParseContext( const TargetBinding& binding )
+   : mBinding( binding )
+   , mHasPrivateValues( true )
+{}
+
+ARGUMENTUM_INLINE void ParseContext::prepare( const ParserDefinition& parserDef )
+{
+   if ( mOptionStates.size() == parserDef.getOptionSlotCount()
+         && mValues.size() == parserDef.getValueSlotCount() )
+      return;
+
+   mOptionStates.assign( parserDef.getOptionSlotCount(), OptionState{} );
+   mValues.assign( parserDef.getValueSlotCount(), nullptr );
+   mPrivateValues.clear();
+   mTouchedOptions.clear();
+   mTouchedValues.clear();
+   mIsOptionTouched.assign( mOptionStates.size(), 0 );
+   mIsValueTouched.assign( mValues.size(), 0 );
+   mSharedValues.clear();
+   mNeedsFullReset = true;
+
+   for ( auto& pOption : parserDef.mOptions )
+      addValue( *pOption );
+
+   for ( auto& pOption : parserDef.mPositional )
+      addValue( *pOption );
+}
+
+ARGUMENTUM_INLINE void ParseContext::addValue( const Option& option )
+{
+   assert( option.mValueSlot < mValues.size() );
+   auto& pValue = mValues[option.mValueSlot];
+   if ( pValue )
+      return;
+
+   if ( mHasPrivateValues ) {
+      auto pPrivate = option.mpValue->clone( mBinding );
+      if ( pPrivate ) {
+         pValue = pPrivate.get();
+         mPrivateValues.push_back( std::move( pPrivate ) );
+         return;
+      }
+   }
+
+   pValue = option.mpValue.get();
+   mSharedValues.push_back( option.mValueSlot );
+}
+
+ARGUMENTUM_INLINE OptionState& ParseContext::getOptionState( const Option& option )
+{
+   assert( option.mSlot < mOptionStates.size() );
+   if ( !mIsOptionTouched[option.mSlot] ) {
+      mIsOptionTouched[option.mSlot] = 1;
+      mTouchedOptions.push_back( option.mSlot );
+   }
+   return mOptionStates[option.mSlot];
+}
+
+ARGUMENTUM_INLINE const OptionState& ParseContext::getOptionState( const Option& option ) const
+{
+   assert( option.mSlot < mOptionStates.size() );
+   return mOptionStates[option.mSlot];
+}
+
+ARGUMENTUM_INLINE Value& ParseContext::getValue( const Option& option )
+{
+   assert( option.mValueSlot < mValues.size() && mValues[option.mValueSlot] );
+   if ( !mIsValueTouched[option.mValueSlot] ) {
+      mIsValueTouched[option.mValueSlot] = 1;
+      mTouchedValues.push_back( option.mValueSlot );
+   }
+   return *mValues[option.mValueSlot];
+}
+
+ARGUMENTUM_INLINE const Value& ParseContext::getValue( const Option& option ) const
+{
+   assert( option.mValueSlot < mValues.size() && mValues[option.mValueSlot] );
+   return *mValues[option.mValueSlot];
+}
+
+ARGUMENTUM_INLINE const OptionState& ParseContext::getOptionState( size_t slot ) const
+{
+   assert( slot < mOptionStates.size() );
+   return mOptionStates[slot];
+}
+
+ARGUMENTUM_INLINE bool ParseContext::wasValueAssigned( size_t valueSlot ) const
+{
+   assert( valueSlot < mValues.size() && mValues[valueSlot] );
+   return mValues[valueSlot]->getAssignCount() > 0;
+}
+
+ARGUMENTUM_INLINE const std::vector<size_t>& ParseContext::getTouchedOptions() const
+{
+   return mTouchedOptions;
+}
+
+ARGUMENTUM_INLINE const std::vector<size_t>& ParseContext::getTouchedValues() const
+{
+   return mTouchedValues;
+}
+
+ARGUMENTUM_INLINE void ParseContext::reset()
+{
+   if ( mNeedsFullReset ) {
+      std::fill( mOptionStates.begin(), mOptionStates.end(), OptionState{} );
+      for ( auto pValue : mValues )
+         pValue->reset();
+      mNeedsFullReset = false;
+   }
+   else {
+      for ( auto slot : mTouchedOptions )
+         mOptionStates[slot] = {};
+      for ( auto slot : mTouchedValues )
+         mValues[slot]->reset();
+
+      // The program may change the targets of the definition between parses.
+      for ( auto slot : mSharedValues )
+         if ( !mIsValueTouched[slot] )
+            mValues[slot]->reset();
+   }
+
+   for ( auto slot : mTouchedOptions )
+      mIsOptionTouched[slot] = 0;
+   for ( auto slot : mTouchedValues )
+      mIsValueTouched[slot] = 0;
+   mTouchedOptions.clear();
+   mTouchedValues.clear();
+}
+
+ARGUMENTUM_INLINE GroupSet& ParseContext::getUsedGroups()
+{
+   return mUsedGroups;
+}
+
+ARGUMENTUM_INLINE GroupSet& ParseContext::getViolatedGroups()
+{
+   return mViolatedGroups;
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<CommandOptions> ParseContext::getCommandOptions(
+      Command& command )
+{
+   if ( !mHasPrivateValues )
+      return command.getOptions();
+
+   auto& state = getCommandState( command );
+   if ( !state.pOptions )
+      state.pOptions = command.hasFactory() ? command.createOptions() : command.getOptions();
+
+   return state.pOptions;
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<argument_parser>& ParseContext::getCommandParser(
+      Command& command )
+{
+   if ( !mHasPrivateValues )
+      return command.mpParser;
+
+   return getCommandState( command ).pParser;
+}
+
+ARGUMENTUM_INLINE const CompletionTrie& ParseContext::getCompletionTrie(
+      const ParserDefinition& parserDef )
+{
+   if ( !mpCompletionTrie || mpTrieDefinition != &parserDef
+         || mTrieGeneration != parserDef.getGeneration() ) {
+      mpCompletionTrie = parserDef.getNameIndexCache().getCompletionTrie( parserDef );
+      mpTrieDefinition = &parserDef;
+      mTrieGeneration = parserDef.getGeneration();
+   }
+
+   return *mpCompletionTrie;
+}
+
+ARGUMENTUM_INLINE const std::vector<std::string_view>& ParseContext::findSimilarOptions(
+      const ParserDefinition& parserDef, std::string_view name )
+{
+   constexpr size_t maxSuggestions = 3;
+   mSuggestions.clear();
+
+   // One edit is allowed for every four characters after the dashes, but not
+   // more than two.
+   auto length = name.size() - std::min( name.size(), name.find_first_not_of( '-' ) );
+   auto maxDistance = unsigned( std::min<size_t>( 2, length / 4 ) );
+   if ( maxDistance == 0 )
+      return mSuggestions;
+
+   if ( !mpEditIndex || mpIndexDefinition != &parserDef
+         || mIndexGeneration != parserDef.getGeneration() ) {
+      mpEditIndex = parserDef.getNameIndexCache().getEditIndex( parserDef );
+      mpIndexDefinition = &parserDef;
+      mIndexGeneration = parserDef.getGeneration();
+   }
+
+   mpEditIndex->findNeighbors( name, maxSuggestions, mSuggestions );
+   if ( !mSuggestions.empty() || maxDistance < 2 )
+      return mSuggestions;
+
+   auto& trie = getCompletionTrie( parserDef );
+   auto kind = CompletionTrie::optionName;
+   trie.findSimilar( name, maxDistance, kind, maxSuggestions, mSimilarNames );
+   for ( auto& match : mSimilarNames )
+      mSuggestions.push_back( match.pEntry->name );
+
+   return mSuggestions;
+}
+
+ARGUMENTUM_INLINE auto ParseContext::getCommandState( const Command& command ) -> CommandState&
+{
+   auto& state = mCommands[&command];
+   if ( state.factoryVersion != command.mFactoryVersion )
+      state = CommandState{ nullptr, nullptr, command.mFactoryVersion };
+
+   return state;
+}
+
+}   // namespace argumentum
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "argumentlexer.h"
 #include "parserconfig.h"
 #include "parserdefinition.h"
 
@@ -15,13 +16,15 @@ namespace argumentum {
 
 class Option;
 class Command;
+class ParseContext;
 class ParseResultBuilder;
 class ArgumentStream;
-enum class EArgumentType;
+class argument_parser;
 
 class Parser
 {
    const ParserDefinition& mParserDef;
+   ParseContext& mContext;
    ParseResultBuilder& mResult;
 
    bool mIgnoreOptions = false;
@@ -30,17 +33,35 @@ class Parser
    Option* mpActiveOption = nullptr;
 
 public:
-   Parser( const ParserDefinition& argParser, ParseResultBuilder& result );
+   Parser( const ParserDefinition& argParser, ParseContext& context, ParseResultBuilder& result );
    void parse( ArgumentStream& argStream );
 
+   /**
+    * Assign the values of environment variables to the options that read
+    * them and were not set by the input arguments.  The environment is walked
+    * once and the names of the variables are looked up in the option table.
+    */
+   void parseEnvironment();
+
+   /**
+    * Get the parser for the options of @p command that is cached in
+    * @p context.  The parser is built when the command is selected for the
+    * first time.
+    */
+   static argument_parser& getCommandParser(
+         const ParserDefinition& parserDef, ParseContext& context, Command& command );
+
 private:
-   void startOption( std::string_view name );
+   void startOption( const ArgumentToken& token );
    bool optionWithNameExists( std::string_view name );
+   bool isCompletionRequest( std::string_view arg ) const;
+   void complete( ArgumentStream& argStream );
    bool haveActiveOption() const;
    void closeOption();
    void addFreeArgument( std::string_view arg );
    void addError( std::string_view optionName, int errorCode );
-   void setValue( Option& option, std::string_view value );
+   void setValue( const Option& option, std::string_view value );
+   static const char* const* processEnvironment();
    void autoSetMissingValue( Option& option );
 
    void parse( ArgumentStream& argStream, unsigned depth );
@@ -48,7 +69,7 @@ private:
          Command& command, ArgumentStream& argStream, ParseResultBuilder& result );
    void parseForwardedArguments( Option& option, std::string_view args );
    void parseSubstream( std::string_view streamName, unsigned depth );
-   EArgumentType getNextArgumentType( std::string_view arg );
+   EArgumentType getNextArgumentType( const ArgumentToken& token );
 };
 
 }   // namespace argumentum
@@ -4,18 +4,29 @@
 #pragma once
 
 #include "argparser.h"
+#include "argumentlexer.h"
 #include "argumentstream.h"
 #include "command.h"
+#include "completer.h"
 #include "option.h"
+#include "parsecontext.h"
 #include "parser.h"
 #include "parseresult.h"
 
-#include <regex>
+#include <algorithm>
+#include <cstdlib>
+
+#if !defined( _WIN32 )
+// POSIX defines the variable but the headers declare it only with extensions.
+extern char** environ;
+#endif
 
 namespace argumentum {
 
-ARGUMENTUM_INLINE Parser::Parser( const ParserDefinition& parserDef, ParseResultBuilder& result )
+ARGUMENTUM_INLINE Parser::Parser(
+      const ParserDefinition& parserDef, ParseContext& context, ParseResultBuilder& result )
    : mParserDef( parserDef )
+   , mContext( context )
    , mResult( result )
 {}
 
@@ -34,65 +45,85 @@ ARGUMENTUM_INLINE void Parser::parse( ArgumentStream& argStream )
       closeOption();
 }
 
-enum class EArgumentType {
-   // A free argument is not an option or an option value.
-   freeArgument,
-
-   // Include the contents of a file as options.
-   include,
-
-   // Treat the rest of the arguments as free argumetns.
-   endOfOptions,
+ARGUMENTUM_INLINE void Parser::parseEnvironment()
+{
+   auto& table = mParserDef.getOptionTable();
+   auto isSetByArguments = [&]( const auto& item ) {
+      return mContext.wasValueAssigned( table.valueSlots[item.second] );
+   };
+   if ( std::all_of( table.envSlots.begin(), table.envSlots.end(), isSetByArguments ) )
+      return;
+
+   auto pEnvironment = mParserDef.getConfig().environment();
+   if ( !pEnvironment )
+      pEnvironment = processEnvironment();
+   if ( !pEnvironment )
+      return;
+
+   // An option from an exclusive group that was used in the arguments has a
+   // higher precedence than the variables of the other options in the group.
+   auto& argumentGroups = mContext.getUsedGroups();
+   argumentGroups.reset( table.groups.size() );
+   for ( auto slot : mContext.getTouchedOptions() ) {
+      auto iGroup = slot < table.firstPositional ? table.groupIndices[slot] : OptionTable::noGroup;
+      if ( iGroup != OptionTable::noGroup && table.groups[iGroup]->isExclusive()
+            && mContext.getOptionState( slot ).totalAssignCount > 0 )
+         argumentGroups.insert( iGroup );
+   }
 
-   // An option with a long name, currently identified with '--' prefix.
-   longOption,
+   for ( auto pEntry = pEnvironment; *pEntry; ++pEntry ) {
+      auto pText = *pEntry;
+      if ( !table.envFirstChars.test( static_cast<unsigned char>( pText[0] ) ) )
+         continue;
 
-   // An option with a sinble character name, currently identified with '-' prefix.
-   shortOption,
+      auto entry = std::string_view( pText );
+      auto eqpos = entry.find( '=' );
+      if ( eqpos == std::string_view::npos
+            || !( table.envNameLengths & ( uint64_t( 1 ) << std::min<size_t>( eqpos, 63 ) ) ) )
+         continue;
 
-   // Short options can be combined in a single argument prefixed with '-'.
-   multiOption,
+      auto it = table.envSlots.find( entry.substr( 0, eqpos ) );
+      if ( it == table.envSlots.end() || mContext.wasValueAssigned( table.valueSlots[it->second] ) )
+         continue;
 
-   // A value of an option that accepts one or more valuers.
-   optionValue,
+      auto iGroup = it->second < table.firstPositional ? table.groupIndices[it->second]
+                                                       : OptionTable::noGroup;
+      if ( iGroup != OptionTable::noGroup && argumentGroups.contains( iGroup ) )
+         continue;
 
-   // The name of a command.
-   commandName
-};
+      auto& option = *table.options[it->second];
+      option.onOptionStarted( mContext );
+      setValue( option, entry.substr( eqpos + 1 ) );
+   }
+}
 
-namespace {
-ARGUMENTUM_INLINE bool isNumberLike( std::string_view arg )
+ARGUMENTUM_INLINE const char* const* Parser::processEnvironment()
 {
-   static auto rxNumber = std::regex(
-         "^0b[01]+$"
-         "|"
-         "^0o[0-7]+$"
-         "|"
-         "^(0d)?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?$"
-         "|"
-         "^0x[0-9a-fA-F]*\\.?[0-9a-fA-F]+([pP][-+]?[0-9a-fA-F]+)?$" );
-   return std::regex_match( std::begin( arg ), std::end( arg ), rxNumber );
+#if defined( _WIN32 )
+   return _environ;
+#else
+   return environ;
+#endif
 }
-}   // namespace
 
 ARGUMENTUM_INLINE bool Parser::optionWithNameExists( std::string_view name )
 {
    return mParserDef.findOption( name ) != nullptr;
 }
 
-ARGUMENTUM_INLINE EArgumentType Parser::getNextArgumentType( std::string_view arg )
+ARGUMENTUM_INLINE EArgumentType Parser::getNextArgumentType( const ArgumentToken& token )
 {
    if ( mIgnoreOptions )
       return EArgumentType::freeArgument;
 
-   if ( arg.substr( 0, 1 ) == "@" )
-      return EArgumentType::include;
-
-   if ( arg == "--" )
-      return EArgumentType::endOfOptions;
-
-   if ( arg.substr( 0, 2 ) == "--" )
-      return EArgumentType::longOption;
+   switch ( token.type ) {
+      case EArgumentType::include:
+      case EArgumentType::endOfOptions:
+      case EArgumentType::longOption:
+         return token.type;
+      default:
+         break;
+   }
 
    // TODO: negativeMode should be a global parser setting.
    //   - argparse mode: if a -N option exists, treat -M args as options
@@ -105,35 +136,32 @@ ARGUMENTUM_INLINE EArgumentType Parser::getNextArgumentType( std::string_view ar
    enum class ENegativeMode { argparse, argumentum };
    const auto negativeMode = ENegativeMode::argumentum;
 
-   if ( arg.substr( 0, 1 ) == "-" ) {
-      if ( isNumberLike( arg.substr( 1 ) ) ) {
+   if ( token.type == EArgumentType::shortOption || token.type == EArgumentType::multiOption ) {
+      if ( token.isNumber ) {
          if constexpr ( negativeMode == ENegativeMode::argparse ) {
             if ( !mParserDef.hasNumericOptions() )
                return haveActiveOption() ? EArgumentType::optionValue : EArgumentType::freeArgument;
          }
          else {
             if ( haveActiveOption() ) {
-               if ( mpActiveOption->willAcceptArgument() && !mpActiveOption->isPositional() )
+               if ( mpActiveOption->willAcceptArgument( mContext )
+                     && !mpActiveOption->isPositional() )
                   return EArgumentType::optionValue;
             }
-            else if ( !optionWithNameExists( arg.substr( 0, 2 ) ) )
+            else if ( !optionWithNameExists( token.text.substr( 0, 2 ) ) )
                return EArgumentType::freeArgument;
          }
       }
 
-      if ( arg.size() == 2 )
-         return EArgumentType::shortOption;
-
-      if ( arg.size() > 2 )
-         return EArgumentType::multiOption;
+      return token.type;
    }
 
    if ( haveActiveOption() ) {
-      if ( mpActiveOption->willAcceptArgument() )
+      if ( mpActiveOption->willAcceptArgument( mContext ) )
          return EArgumentType::optionValue;
    }
 
-   auto pCommand = mParserDef.findCommand( arg );
+   auto pCommand = mParserDef.matchCommand( token.text );
    if ( pCommand )
       return EArgumentType::commandName;
 
@@ -142,8 +170,16 @@ ARGUMENTUM_INLINE EArgumentType Parser::getNextArgumentType( std::string_view ar
 
 ARGUMENTUM_INLINE void Parser::parse( ArgumentStream& argStream, unsigned depth )
 {
-   for ( auto optArg = argStream.next(); !!optArg; optArg = argStream.next() ) {
-      switch ( getNextArgumentType( *optArg ) ) {
+   auto optArg = argStream.next();
+   if ( depth == 0 && optArg && isCompletionRequest( *optArg ) ) {
+      complete( argStream );
+      return;
+   }
+
+   ArgumentLexer lexer;
+   for ( ; !!optArg; optArg = argStream.next() ) {
+      auto token = lexer.lex( *optArg );
+      switch ( getNextArgumentType( token ) ) {
          case EArgumentType::include:
             parseSubstream( optArg->substr( 1 ), depth );
             continue;
@@ -158,7 +194,7 @@ ARGUMENTUM_INLINE void Parser::parse( ArgumentStream& argStream, unsigned depth
 
          case EArgumentType::longOption:
          case EArgumentType::shortOption:
-            startOption( *optArg );
+            startOption( token );
             break;
 
          case EArgumentType::multiOption: {
@@ -166,7 +202,7 @@ ARGUMENTUM_INLINE void Parser::parse( ArgumentStream& argStream, unsigned depth
             auto opt = std::string{ "--" };
             for ( unsigned i = 1; i < arg_view.size(); ++i ) {
                opt[1] = arg_view[i];
-               startOption( opt );
+               startOption( lexer.lex( opt ) );
             }
             break;
          }
@@ -174,12 +210,12 @@ ARGUMENTUM_INLINE void Parser::parse( ArgumentStream& argStream, unsigned depth
          case EArgumentType::optionValue:
             assert( mpActiveOption != nullptr );
             setValue( *mpActiveOption, *optArg );
-            if ( !mpActiveOption->willAcceptArgument() )
+            if ( !mpActiveOption->willAcceptArgument( mContext ) )
                closeOption();
             break;
 
          case EArgumentType::commandName: {
-            auto pCommand = mParserDef.findCommand( *optArg );
+            auto pCommand = mParserDef.matchCommand( *optArg );
             if ( pCommand ) {
                parseCommandArguments( *pCommand, argStream, mResult );
                return;
@@ -193,29 +229,56 @@ ARGUMENTUM_INLINE void Parser::parse( ArgumentStream& argStream, unsigned depth
    }
 }
 
-ARGUMENTUM_INLINE void Parser::startOption( std::string_view optionStr )
+ARGUMENTUM_INLINE bool Parser::isCompletionRequest( std::string_view arg ) const
+{
+   auto& command = mParserDef.getConfig().completion_command();
+   return !command.empty() && arg == command;
+}
+
+// The rest of the arguments is a completion query or a request for a
+// completion script.
+ARGUMENTUM_INLINE void Parser::complete( ArgumentStream& argStream )
+{
+   std::vector<std::string_view> words;
+   for ( auto optArg = argStream.next(); !!optArg; optArg = argStream.next() )
+      words.push_back( *optArg );
+
+   auto pStream = mParserDef.getConfig().output_stream();
+   assert( pStream );
+
+   Completer completer( mParserDef, mContext );
+   if ( words.size() > 1 && words[0] == "script" )
+      completer.writeScript( words[1], *pStream );
+   else if ( !words.empty() )
+      completer.complete( words[0], { words.begin() + 1, words.end() }, *pStream );
+
+   mResult.requestExit();
+}
+
+ARGUMENTUM_INLINE void Parser::startOption( const ArgumentToken& token )
 {
    if ( haveActiveOption() )
       closeOption();
 
+   auto optionStr = token.text;
    std::string_view name;
    std::string_view arg;
 
    // A comma in the option may start a list of forwarded arguments.
-   auto commapos = optionStr.find( "," );
+   auto commapos = token.commapos;
    if ( commapos != std::string::npos ) {
       name = optionStr.substr( 0, commapos );
       arg = optionStr.substr( commapos + 1 );
 
       auto pOption = mParserDef.findOption( name );
       if ( pOption && pOption->isForwarded() && !arg.empty() ) {
-         pOption->onOptionStarted();
+         pOption->onOptionStarted( mContext );
          parseForwardedArguments( *pOption, arg );
          return;
       }
    }
 
-   auto eqpos = optionStr.find( "=" );
+   auto eqpos = token.eqpos;
    if ( eqpos != std::string::npos ) {
       name = optionStr.substr( 0, eqpos );
       arg = optionStr.substr( eqpos + 1 );
@@ -226,61 +289,35 @@ ARGUMENTUM_INLINE void Parser::startOption( std::string_view optionStr )
    auto pOption = mParserDef.findOption( name );
    if ( pOption ) {
       auto& option = *pOption;
-      option.onOptionStarted();
-      if ( option.willAcceptArgument() )
+      option.onOptionStarted( mContext );
+      if ( option.willAcceptArgument( mContext ) )
          mpActiveOption = pOption;
       else
          setValue( option, option.getFlagValue() );
 
       if ( !arg.empty() ) {
-         if ( option.willAcceptArgument() )
-            setValue( option, std::string{ arg } );
+         if ( option.willAcceptArgument( mContext ) )
+            setValue( option, arg );
          else
             addError( pOption->getHelpName(), FLAG_PARAMETER );
       }
    }
-   else
-      addError( name, UNKNOWN_OPTION );
+   else {
+      // The similar names are searched only on the error path.  The trie of
+      // the names is built by the first unknown option.
+      auto& suggestions = mContext.findSimilarOptions( mParserDef, name );
+      mResult.addError( name, UNKNOWN_OPTION, suggestions );
+   }
 }
 
 ARGUMENTUM_INLINE void Parser::parseForwardedArguments( Option& option, std::string_view args )
 {
    // Forwarded arguments are a comma delimited list.  Split it and add each
    // argument as an option value.
-
-   auto addArg( [this, &option]( const std::string& str ) {
-      if ( !str.empty() )
-         setValue( option, str );
-   } );
-
-   std::stringstream ssarg;
-   auto it = args.begin();
-
-   // The parameter args is the part of the opition after the comma, so the
-   // first comma of args is always escaped.
-   if ( it != args.end() && *it == ',' ) {
-      ssarg << ',';
-      ++it;
-   }
-
-   for ( ; it != args.end(); ++it ) {
-      if ( *it == ',' ) {
-         auto inext = it + 1;
-         if ( inext != args.end() && *inext == ',' ) {
-            ssarg << ',';
-            it = inext;
-         }
-         else {
-            addArg( ssarg.str() );
-            ssarg.str( "" );
-         }
-         continue;
-      }
-
-      ssarg << *it;
-   }
-
-   addArg( ssarg.str() );
+   ForwardedArgumentSplitter splitter( args );
+   option.reserveValues( mContext, splitter.countRemaining() );
+   for ( auto arg = splitter.next(); arg; arg = splitter.next() )
+      setValue( option, *arg );
 }
 
 ARGUMENTUM_INLINE bool Parser::haveActiveOption() const
@@ -292,9 +329,10 @@ ARGUMENTUM_INLINE void Parser::closeOption()
 {
    if ( haveActiveOption() ) {
       auto& option = *mpActiveOption;
-      if ( option.needsMoreArguments() )
+      if ( option.needsMoreArguments( mContext ) )
          addError( option.getHelpName(), MISSING_ARGUMENT );
-      else if ( option.willAcceptArgument() && !option.wasAssignedThroughThisOption() )
+      else if ( option.willAcceptArgument( mContext )
+            && !option.wasAssignedThroughThisOption( mContext ) )
          autoSetMissingValue( option );
    }
    mpActiveOption = nullptr;
@@ -304,7 +342,7 @@ ARGUMENTUM_INLINE void Parser::addFreeArgument( std::string_view arg )
 {
    while ( mPosition < mParserDef.mPositional.size() ) {
       auto& option = *mParserDef.mPositional[mPosition];
-      if ( option.willAcceptArgument() ) {
+      if ( option.willAcceptArgument( mContext ) ) {
          setValue( option, arg );
          return;
       }
@@ -319,11 +357,11 @@ ARGUMENTUM_INLINE void Parser::addError( std::string_view optionName, int errorC
    mResult.addError( optionName, errorCode );
 }
 
-ARGUMENTUM_INLINE void Parser::setValue( Option& option, std::string_view value )
+ARGUMENTUM_INLINE void Parser::setValue( const Option& option, std::string_view value )
 {
    try {
       auto env = Environment{ option, mResult, mParserDef };
-      option.setValue( value, env );
+      option.setValue( value, mContext, env );
    }
    catch ( const InvalidChoiceError& ) {
       addError( option.getHelpName(), INVALID_CHOICE );
@@ -340,7 +378,7 @@ ARGUMENTUM_INLINE void Parser::autoSetMissingValue( Option& option )
 {
    try {
       auto env = Environment{ option, mResult, mParserDef };
-      option.autoSetMissingValue( env );
+      option.autoSetMissingValue( mContext, env );
    }
    catch ( const InvalidChoiceError& ) {
       addError( option.getHelpName(), INVALID_CHOICE );
@@ -353,27 +391,56 @@ ARGUMENTUM_INLINE void Parser::autoSetMissingValue( Option& option )
    }
 }
 
-// A parser for command's (sub)options is instantiated only when a command is
-// selected by an input argument.
 ARGUMENTUM_INLINE void Parser::parseCommandArguments(
       Command& command, ArgumentStream& argStream, ParseResultBuilder& result )
 {
-   auto parser = argument_parser::createSubParser();
-   auto commandpath = mParserDef.getConfig().program() + " " + command.getName();
-   parser.config().program( commandpath ).description( command.getHelp() );
-
-   auto pcout = mParserDef.getConfig().output_stream();
-   assert( pcout );
-   parser.config().cout( *pcout );
-
-   auto pCmdOptions = command.getOptions();
-   if ( pCmdOptions ) {
-      parser.params().add_parameters( pCmdOptions );
+   auto& parser = getCommandParser( mParserDef, mContext, command );
+   auto pCmdOptions = mContext.getCommandOptions( command );
+   if ( pCmdOptions )
       result.addCommand( pCmdOptions );
-   }
    result.addResult( parser.parse_args( argStream ) );
 }
 
+// A parser for command's (sub)options is instantiated only when a command is
+// selected by an input argument.  The parser is cached and reused when the
+// command is selected again.
+ARGUMENTUM_INLINE argument_parser& Parser::getCommandParser(
+      const ParserDefinition& parserDef, ParseContext& context, Command& command )
+{
+   auto& pParser = context.getCommandParser( command );
+   if ( !pParser ) {
+      auto pCmdOptions = context.getCommandOptions( command );
+      pParser = argument_parser::createSubParser();
+      if ( pCmdOptions )
+         pParser->params().add_parameters( pCmdOptions );
+   }
+
+   // The configuration of the parent and the help of the command may be
+   // changed between parses.  The program name and the description are set
+   // only when they change so that the cached help of the command stays valid.
+   auto& parentConfig = parserDef.getConfig();
+   auto& config = pParser->getConfig();
+   auto& parentProgram = parentConfig.program();
+   auto& name = command.getName();
+   auto& program = config.program();
+   auto isCommandPath = program.size() == parentProgram.size() + 1 + name.size()
+         && program.compare( 0, parentProgram.size(), parentProgram ) == 0
+         && program[parentProgram.size()] == ' '
+         && program.compare( parentProgram.size() + 1, name.size(), name ) == 0;
+   if ( !isCommandPath )
+      pParser->config().program( parentProgram + " " + name );
+   if ( config.description() != command.getHelp() )
+      pParser->config().description( command.getHelp() );
+
+   auto pcout = parentConfig.output_stream();
+   assert( pcout );
+   pParser->config()
+         .cout( *pcout )
+         .environment( parentConfig.environment() )
+         .allow_command_prefixes( parentConfig.allow_command_prefixes() );
+   return *pParser;
+}
+
 ARGUMENTUM_INLINE void Parser::parseSubstream( std::string_view streamName, unsigned depth )
 {
    if ( !mParserDef.getConfig().filesystem() )
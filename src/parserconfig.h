@@ -6,6 +6,7 @@
 #include "filesystem.h"
 
 #include <memory>
+#include <memory_resource>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -26,20 +27,34 @@ public:
       std::string mUsage;
       std::string mDescription;
       std::string mEpilog;
+      std::string mCompletionCommand;
       unsigned mMaxIncludeDepth = 8;
+      bool mAllowCommandPrefixes = false;
+      bool mPrecomputeHelp = false;
+
+      // Changed when a text that is displayed in the help changes.
+      unsigned mHelpRevision = 0;
       std::ostream* mpOutStream = nullptr;
       std::shared_ptr<IFormatHelp> mpHelpFormatter;
       std::shared_ptr<Filesystem> mpFilesystem;
+      std::pmr::memory_resource* mpMemoryResource = nullptr;
+      const char* const* mpEnvironment = nullptr;
 
    public:
       const std::string& program() const;
       const std::string& usage() const;
       const std::string& description() const;
       const std::string& epilog() const;
+      const std::string& completion_command() const;
       unsigned max_include_depth() const;
+      bool allow_command_prefixes() const;
+      bool precompute_help() const;
+      unsigned help_revision() const;
       std::ostream* output_stream() const;
       std::shared_ptr<IFormatHelp> help_formatter( const std::string& helpOption ) const;
       std::shared_ptr<Filesystem> filesystem() const;
+      std::pmr::memory_resource* memory_resource() const;
+      const char* const* environment() const;
    };
 
 private:
@@ -49,7 +64,8 @@ public:
    // Used internally to access the configured parameters.
    const Data& data() const;
 
-   // Set the program name to be used in the generated help.
+   // Set the program name to be used in the generated help and in the shell
+   // completion scripts, which are not written without it.
    ParserConfig& program( std::string_view program );
 
    // Set the usage string to be used in the generated help. This overrides the
@@ -73,6 +89,38 @@ public:
 
    // Set the help formatter that will format and display help.
    ParserConfig& help_formatter( std::shared_ptr<IFormatHelp> pFormatter );
+
+   // Select a command with an unambiguous prefix of its name, for example
+   // `stat` for `status`.  Commands of commands inherit the setting.
+   ParserConfig& allow_command_prefixes( bool allow = true );
+
+   // Render the help when the definition is verified before parsing, so that
+   // the first request for help is served from the cache.  The help is
+   // rendered again only when the definition changes.
+   ParserConfig& precompute_help( bool precompute = true );
+
+   // Answer shell completion queries when the first input argument is
+   // @p command.  The following arguments are the name of the shell (bash,
+   // zsh or fish) and the words of the command line after the program name,
+   // ending with the word that is completed.  The candidates are written to
+   // the output stream one per line and the parser exits.  With the arguments
+   // `script <shell>` a completion script for the shell is written instead.
+   // The command is not shown in the help.
+   ParserConfig& completion( std::string_view command = "__complete" );
+
+   // Set the memory resource from which the parse results allocate the
+   // errors and the ignored arguments.  If it is not set, the default memory
+   // resource is used.
+   // NOTE: The @p pResource must outlive the parser and the parse results.
+   ParserConfig& memory_resource( std::pmr::memory_resource* pResource );
+
+   // Set the environment from which the options configured with env() read
+   // their values.  The environment is an array of `NAME=value` strings that
+   // ends with a null pointer, like `environ`.  If it is not set, the
+   // environment of the process is read.  Commands use the environment of
+   // their parent.
+   // NOTE: The @p pEnvironment must stay valid while the parser parses.
+   ParserConfig& environment( const char* const* pEnvironment );
 };
 
 }   // namespace argumentum
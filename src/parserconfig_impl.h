@@ -20,24 +20,28 @@ ARGUMENTUM_INLINE const ParserConfig::Data& ParserConfig::data() const
 ARGUMENTUM_INLINE ParserConfig& ParserConfig::program( std::string_view program )
 {
    mData.mProgram = program;
+   ++mData.mHelpRevision;
    return *this;
 }
 
 ARGUMENTUM_INLINE ParserConfig& ParserConfig::usage( std::string_view usage )
 {
    mData.mUsage = usage;
+   ++mData.mHelpRevision;
    return *this;
 }
 
 ARGUMENTUM_INLINE ParserConfig& ParserConfig::description( std::string_view description )
 {
    mData.mDescription = description;
+   ++mData.mHelpRevision;
    return *this;
 }
 
 ARGUMENTUM_INLINE ParserConfig& ParserConfig::epilog( std::string_view epilog )
 {
    mData.mEpilog = epilog;
+   ++mData.mHelpRevision;
    return *this;
 }
 
@@ -60,6 +64,37 @@ ARGUMENTUM_INLINE ParserConfig& ParserConfig::help_formatter(
    return *this;
 }
 
+ARGUMENTUM_INLINE ParserConfig& ParserConfig::allow_command_prefixes( bool allow )
+{
+   mData.mAllowCommandPrefixes = allow;
+   return *this;
+}
+
+ARGUMENTUM_INLINE ParserConfig& ParserConfig::precompute_help( bool precompute )
+{
+   mData.mPrecomputeHelp = precompute;
+   return *this;
+}
+
+ARGUMENTUM_INLINE ParserConfig& ParserConfig::completion( std::string_view command )
+{
+   mData.mCompletionCommand = command;
+   return *this;
+}
+
+ARGUMENTUM_INLINE ParserConfig& ParserConfig::memory_resource(
+      std::pmr::memory_resource* pResource )
+{
+   mData.mpMemoryResource = pResource;
+   return *this;
+}
+
+ARGUMENTUM_INLINE ParserConfig& ParserConfig::environment( const char* const* pEnvironment )
+{
+   mData.mpEnvironment = pEnvironment;
+   return *this;
+}
+
 ARGUMENTUM_INLINE const std::string& ParserConfig::Data::program() const
 {
    return mProgram;
@@ -80,11 +115,41 @@ ARGUMENTUM_INLINE const std::string& ParserConfig::Data::epilog() const
    return mEpilog;
 }
 
+ARGUMENTUM_INLINE const std::string& ParserConfig::Data::completion_command() const
+{
+   return mCompletionCommand;
+}
+
 ARGUMENTUM_INLINE unsigned ParserConfig::Data::max_include_depth() const
 {
    return mMaxIncludeDepth;
 }
 
+ARGUMENTUM_INLINE bool ParserConfig::Data::allow_command_prefixes() const
+{
+   return mAllowCommandPrefixes;
+}
+
+ARGUMENTUM_INLINE bool ParserConfig::Data::precompute_help() const
+{
+   return mPrecomputeHelp;
+}
+
+ARGUMENTUM_INLINE unsigned ParserConfig::Data::help_revision() const
+{
+   return mHelpRevision;
+}
+
+ARGUMENTUM_INLINE std::pmr::memory_resource* ParserConfig::Data::memory_resource() const
+{
+   return mpMemoryResource;
+}
+
+ARGUMENTUM_INLINE const char* const* ParserConfig::Data::environment() const
+{
+   return mpEnvironment;
+}
+
 ARGUMENTUM_INLINE std::ostream* ParserConfig::Data::output_stream() const
 {
    return mpOutStream ? mpOutStream : &std::cout;
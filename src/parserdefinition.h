@@ -3,12 +3,18 @@
 
 #pragma once
 
+#include "commandtrie.h"
+#include "helpcache.h"
+#include "nameindexcache.h"
 #include "parserconfig.h"
 
+#include <bitset>
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace argumentum {
@@ -17,6 +23,68 @@ class Option;
 class OptionGroup;
 class Command;
 
+/**
+ * The properties of the options that are read in every parse, stored in
+ * arrays indexed by the option slot.  The loops that reset, default and
+ * validate the options run over these arrays and the state in a ParseContext;
+ * the options themselves are touched only to report an error or to assign a
+ * default.
+ *
+ * The slots of the options in mOptions come before the slots of the
+ * positional options.
+ */
+struct OptionTable
+{
+   enum EFlag : uint8_t { required = 1 };
+   static constexpr uint32_t noGroup = ~uint32_t( 0 );
+
+   std::vector<uint8_t> flags;
+   std::vector<int> minArgs;
+   std::vector<size_t> valueSlots;
+
+   // The position of the group of the option in groups or noGroup.  The
+   // groups of positional options are not checked.
+   std::vector<uint32_t> groupIndices;
+
+   // The options are needed only when an error is reported or a default is
+   // assigned.
+   std::vector<const Option*> options;
+
+   // The slots of the required options that are not positional and of the
+   // options with a default value.
+   std::vector<size_t> requiredSlots;
+   std::vector<size_t> defaultSlots;
+
+   // The groups that have options, ordered by name.
+   std::vector<const OptionGroup*> groups;
+
+   // The slots of the options that read an environment variable by the name
+   // of the variable.  A variable is read by the first option that names it.
+   // The entries of the environment are looked up only if the first character
+   // of the name is in envFirstChars and the length of the name (at most 63)
+   // is in envNameLengths.
+   std::unordered_map<std::string_view, size_t> envSlots;
+   std::bitset<256> envFirstChars;
+   uint64_t envNameLengths = 0;
+
+   // The groups of the options that share the value in a value slot.  The
+   // groups of value slot v are at [valueGroupStarts[v], valueGroupStarts[v+1])
+   // in valueGroups.
+   std::vector<uint32_t> valueGroupStarts;
+   std::vector<uint32_t> valueGroups;
+
+   size_t firstPositional = 0;
+   bool hasRequired = false;
+};
+
+// Orders the names of groups without regard to case so that a group can be
+// found without lowercasing a copy of the name.
+struct GroupNameLess
+{
+   using is_transparent = void;
+   bool operator()( std::string_view a, std::string_view b ) const;
+};
+
 class ParserDefinition
 {
    friend class ParameterConfig;
@@ -27,18 +95,91 @@ private:
    // set explicitly with OptionConfig::group().
    std::shared_ptr<OptionGroup> mpActiveGroup;
 
+   // Indices of options in mOptions and commands in mCommands by name.  The
+   // keys are views of the names stored in the options and commands.  The
+   // indices are maintained while the options are registered and are used
+   // only while mIsIndexed is set.
+   std::unordered_map<std::string_view, size_t> mOptionIndex;
+   std::unordered_map<std::string_view, size_t> mCommandIndex;
+   bool mIsIndexed = false;
+
+   // The trie for matching command prefixes is built before parsing.
+   CommandTrie mCommandTrie;
+   bool mIsTrieBuilt = false;
+
+   // The number of option and value slots assigned by assignSlots.
+   size_t mOptionSlotCount = 0;
+   size_t mValueSlotCount = 0;
+
+   // Built after the slots are assigned.  It is dropped when options are
+   // added or changed.
+   OptionTable mOptionTable;
+   bool mIsTableBuilt = false;
+
+   // Changed whenever the options, the commands or the groups change.  The
+   // rendered help and the indices of the names are cached for one
+   // generation.
+   uint64_t mGeneration = 0;
+   mutable HelpCache mHelpCache;
+   mutable NameIndexCache mNameIndexCache;
+
 public:
    ParserConfig mConfig;
    std::vector<std::shared_ptr<Command>> mCommands;
    std::vector<std::shared_ptr<Option>> mOptions;
    std::vector<std::shared_ptr<Option>> mPositional;
-   std::map<std::string, std::shared_ptr<OptionGroup>> mGroups;
+   std::map<std::string, std::shared_ptr<OptionGroup>, GroupNameLess> mGroups;
    std::set<std::string> mHelpOptionNames;
 
 public:
    Option* findOption( std::string_view optionName ) const;
    Command* findCommand( std::string_view commandName ) const;
-   std::shared_ptr<OptionGroup> findGroup( std::string name ) const;
+
+   /**
+    * Find the command selected by the input argument @p arg.  If command
+    * prefixes are allowed in the configuration, an unambiguous prefix of a
+    * command name also selects the command.
+    */
+   Command* matchCommand( std::string_view arg ) const;
+   std::shared_ptr<OptionGroup> findGroup( std::string_view name ) const;
+
+   /**
+    * Build the name indices used by findOption, findCommand and
+    * matchCommand.  The name indices are extended while the options are
+    * registered; the command trie is built before the arguments are parsed.
+    */
+   void buildIndex();
+
+   /**
+    * Drop the name indices.  Called when the names of the registered options
+    * are changed.
+    */
+   void invalidateIndex();
+
+   /**
+    * Assign the positions of the option states and values in a ParseContext
+    * and build the option table.  The slots are reassigned only when options
+    * were added.
+    */
+   void assignSlots();
+   size_t getOptionSlotCount() const;
+   size_t getValueSlotCount() const;
+
+   /**
+    * Drop the option table.  Called when the properties of a registered
+    * option that are stored in the table are changed.
+    */
+   void invalidateOptionTable();
+   const OptionTable& getOptionTable() const;
+
+   /**
+    * Start a new generation of the definition.  Called when anything that is
+    * displayed in the help changes.
+    */
+   void markChanged();
+   uint64_t getGeneration() const;
+   HelpCache& getHelpCache() const;
+   NameIndexCache& getNameIndexCache() const;
 
    /**
     * Get a reference to the parser configuration for inspection.
@@ -49,6 +190,18 @@ public:
     * @Returns true if there are short options that include digits.
     */
    bool hasNumericOptions() const;
+
+private:
+   // Add the option or command that was appended to the definition to the
+   // index if the index is already built.
+   void indexLastOption();
+   void indexLastCommand();
+   void addOptionToIndex( size_t iOption );
+
+   // Build the name indices of options and commands if they were dropped.
+   // Until they are built, the names are searched linearly.
+   void buildNameIndex();
+   void buildOptionTable();
 };
 
 }   // namespace argumentum
@@ -6,12 +6,20 @@
 #include "command.h"
 #include "option.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cctype>
 #include <string_view>
 
 namespace argumentum {
 
 ARGUMENTUM_INLINE Option* ParserDefinition::findOption( std::string_view optionName ) const
 {
+   if ( mIsIndexed ) {
+      auto it = mOptionIndex.find( optionName );
+      return it != mOptionIndex.end() ? mOptions[it->second].get() : nullptr;
+   }
+
    for ( auto& pOption : mOptions )
       if ( pOption->hasName( optionName ) )
          return pOption.get();
@@ -21,6 +29,14 @@ ARGUMENTUM_INLINE Option* ParserDefinition::findOption( std::string_view optionN
 
 ARGUMENTUM_INLINE Command* ParserDefinition::findCommand( std::string_view commandName ) const
 {
+   if ( mCommands.empty() )
+      return nullptr;
+
+   if ( mIsIndexed ) {
+      auto it = mCommandIndex.find( commandName );
+      return it != mCommandIndex.end() ? mCommands[it->second].get() : nullptr;
+   }
+
    for ( auto& pCommand : mCommands )
       if ( pCommand->hasName( commandName ) )
          return pCommand.get();
@@ -28,17 +44,261 @@ ARGUMENTUM_INLINE Command* ParserDefinition::findCommand( std::string_view comma
    return nullptr;
 }
 
-ARGUMENTUM_INLINE std::shared_ptr<OptionGroup> ParserDefinition::findGroup( std::string name ) const
+ARGUMENTUM_INLINE Command* ParserDefinition::matchCommand( std::string_view arg ) const
+{
+   if ( mCommands.empty() || !getConfig().allow_command_prefixes() )
+      return findCommand( arg );
+
+   if ( mIsTrieBuilt ) {
+      auto index = mCommandTrie.findByPrefix( arg );
+      return index >= 0 ? mCommands[index].get() : nullptr;
+   }
+
+   auto pFound = findCommand( arg );
+   if ( pFound || arg.empty() )
+      return pFound;
+
+   for ( auto& pCommand : mCommands ) {
+      if ( pCommand->getName().compare( 0, arg.size(), arg ) == 0 ) {
+         if ( pFound )
+            return nullptr;
+         pFound = pCommand.get();
+      }
+   }
+
+   return pFound;
+}
+
+ARGUMENTUM_INLINE bool GroupNameLess::operator()( std::string_view a, std::string_view b ) const
+{
+   return std::lexicographical_compare(
+         a.begin(), a.end(), b.begin(), b.end(), []( char ca, char cb ) {
+            return tolower( static_cast<unsigned char>( ca ) )
+                  < tolower( static_cast<unsigned char>( cb ) );
+         } );
+}
+
+ARGUMENTUM_INLINE std::shared_ptr<OptionGroup> ParserDefinition::findGroup(
+      std::string_view name ) const
 {
-   std::transform( name.begin(), name.end(), name.begin(), []( char ch ) {
-      return char( tolower( ch ) );
-   } );
    auto igrp = mGroups.find( name );
    if ( igrp == mGroups.end() )
       return {};
    return igrp->second;
 }
 
+ARGUMENTUM_INLINE void ParserDefinition::buildIndex()
+{
+   buildNameIndex();
+
+   if ( !mIsTrieBuilt ) {
+      mCommandTrie.build( mCommands );
+      mIsTrieBuilt = true;
+   }
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::buildNameIndex()
+{
+   if ( mIsIndexed )
+      return;
+
+   mOptionIndex.clear();
+   mOptionIndex.reserve( 2 * mOptions.size() );
+   for ( size_t i = 0; i < mOptions.size(); ++i )
+      addOptionToIndex( i );
+
+   mCommandIndex.clear();
+   mCommandIndex.reserve( mCommands.size() );
+   for ( size_t i = 0; i < mCommands.size(); ++i )
+      mCommandIndex.emplace( mCommands[i]->getName(), i );
+
+   mIsIndexed = true;
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::invalidateIndex()
+{
+   mIsIndexed = false;
+   mOptionIndex.clear();
+   mCommandIndex.clear();
+   mIsTrieBuilt = false;
+   mCommandTrie.clear();
+   markChanged();
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::assignSlots()
+{
+   if ( mOptionSlotCount == mOptions.size() + mPositional.size() ) {
+      if ( !mIsTableBuilt )
+         buildOptionTable();
+      return;
+   }
+
+   std::unordered_map<const Value*, size_t> valueSlots;
+   size_t slot = 0;
+   auto assign = [&]( Option& option ) {
+      option.mSlot = slot++;
+      auto iv = valueSlots.emplace( option.mpValue.get(), valueSlots.size() ).first;
+      option.mValueSlot = iv->second;
+   };
+
+   for ( auto& pOption : mOptions )
+      assign( *pOption );
+
+   for ( auto& pOption : mPositional )
+      assign( *pOption );
+
+   mOptionSlotCount = slot;
+   mValueSlotCount = valueSlots.size();
+   buildOptionTable();
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::buildOptionTable()
+{
+   auto& table = mOptionTable;
+   table = OptionTable{};
+   auto count = mOptions.size() + mPositional.size();
+   table.flags.reserve( count );
+   table.minArgs.reserve( count );
+   table.valueSlots.reserve( count );
+   table.groupIndices.reserve( count );
+   table.options.reserve( count );
+
+   // The groups are numbered in the order of their names so that the errors
+   // are reported in the same order as before they were numbered.
+   std::unordered_map<const OptionGroup*, uint32_t> groupIndices;
+   for ( auto& pOption : mOptions )
+      if ( pOption->mpGroup )
+         groupIndices.emplace( pOption->mpGroup.get(), 0 );
+
+   for ( auto& [name, pGroup] : mGroups ) {
+      auto igrp = groupIndices.find( pGroup.get() );
+      if ( igrp != groupIndices.end() ) {
+         igrp->second = uint32_t( table.groups.size() );
+         table.groups.push_back( pGroup.get() );
+      }
+   }
+   assert( table.groups.size() == groupIndices.size() );
+
+   auto add = [&]( const Option& option, bool isPositional ) {
+      assert( option.mSlot == table.flags.size() );
+      auto slot = option.mSlot;
+      table.flags.push_back( option.isRequired() ? OptionTable::required : 0 );
+      table.minArgs.push_back( option.mMinArgs );
+      table.valueSlots.push_back( option.mValueSlot );
+      table.options.push_back( &option );
+
+      auto groupIndex = OptionTable::noGroup;
+      if ( !isPositional && option.mpGroup )
+         groupIndex = groupIndices[option.mpGroup.get()];
+      table.groupIndices.push_back( groupIndex );
+
+      if ( option.isRequired() ) {
+         table.hasRequired = true;
+         if ( !isPositional )
+            table.requiredSlots.push_back( slot );
+      }
+      if ( option.hasDefault() )
+         table.defaultSlots.push_back( slot );
+
+      auto& variable = option.getEnvVariable();
+      if ( !variable.empty() && table.envSlots.emplace( variable, slot ).second ) {
+         table.envFirstChars.set( static_cast<unsigned char>( variable[0] ) );
+         table.envNameLengths |= uint64_t( 1 ) << std::min<size_t>( variable.size(), 63 );
+      }
+   };
+
+   for ( auto& pOption : mOptions )
+      add( *pOption, false );
+
+   table.firstPositional = mOptions.size();
+   for ( auto& pOption : mPositional )
+      add( *pOption, true );
+
+   // Sort the groups of the options by their value slots.
+   table.valueGroupStarts.assign( mValueSlotCount + 1, 0 );
+   for ( size_t slot = 0; slot < table.firstPositional; ++slot )
+      if ( table.groupIndices[slot] != OptionTable::noGroup )
+         ++table.valueGroupStarts[table.valueSlots[slot] + 1];
+
+   for ( size_t v = 0; v < mValueSlotCount; ++v )
+      table.valueGroupStarts[v + 1] += table.valueGroupStarts[v];
+
+   table.valueGroups.resize( table.valueGroupStarts.back() );
+   auto next = table.valueGroupStarts;
+   for ( size_t slot = 0; slot < table.firstPositional; ++slot )
+      if ( table.groupIndices[slot] != OptionTable::noGroup )
+         table.valueGroups[next[table.valueSlots[slot]]++] = table.groupIndices[slot];
+
+   mIsTableBuilt = true;
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::invalidateOptionTable()
+{
+   mIsTableBuilt = false;
+   markChanged();
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::markChanged()
+{
+   ++mGeneration;
+}
+
+ARGUMENTUM_INLINE uint64_t ParserDefinition::getGeneration() const
+{
+   return mGeneration;
+}
+
+ARGUMENTUM_INLINE HelpCache& ParserDefinition::getHelpCache() const
+{
+   return mHelpCache;
+}
+
+ARGUMENTUM_INLINE NameIndexCache& ParserDefinition::getNameIndexCache() const
+{
+   return mNameIndexCache;
+}
+
+ARGUMENTUM_INLINE const OptionTable& ParserDefinition::getOptionTable() const
+{
+   assert( mIsTableBuilt );
+   return mOptionTable;
+}
+
+ARGUMENTUM_INLINE size_t ParserDefinition::getOptionSlotCount() const
+{
+   return mOptionSlotCount;
+}
+
+ARGUMENTUM_INLINE size_t ParserDefinition::getValueSlotCount() const
+{
+   return mValueSlotCount;
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::indexLastOption()
+{
+   if ( mIsIndexed && !mOptions.empty() )
+      addOptionToIndex( mOptions.size() - 1 );
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::indexLastCommand()
+{
+   if ( mIsIndexed && !mCommands.empty() )
+      mCommandIndex.emplace( mCommands.back()->getName(), mCommands.size() - 1 );
+
+   // The flat trie can not be extended so it is rebuilt before the next parse.
+   mIsTrieBuilt = false;
+}
+
+ARGUMENTUM_INLINE void ParserDefinition::addOptionToIndex( size_t iOption )
+{
+   // The first option with a name wins, the same as in a linear search.
+   auto& option = *mOptions[iOption];
+   if ( !option.getShortName().empty() )
+      mOptionIndex.emplace( option.getShortName(), iOption );
+   if ( !option.getLongName().empty() )
+      mOptionIndex.emplace( option.getLongName(), iOption );
+}
+
 ARGUMENTUM_INLINE const ParserConfig::Data& ParserDefinition::getConfig() const
 {
    return mConfig.data();
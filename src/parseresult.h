@@ -5,6 +5,10 @@
 
 #include "command.h"
 
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -41,11 +45,21 @@ enum EError {
 
 struct ParseError
 {
-   const std::string option;
+   // The errors are stored in the arena of a ParseResult.
+   using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+   const std::pmr::string option;
    const int errorCode;
-   ParseError( std::string_view optionName, int code );
+
+   // The names of the options that are similar to an unknown option, the
+   // closest first.
+   std::pmr::vector<std::pmr::string> suggestions;
+
+   ParseError( std::string_view optionName, int code, const allocator_type& alloc = {} );
    ParseError( const ParseError& ) = default;
    ParseError( ParseError&& ) = default;
+   ParseError( const ParseError& other, const allocator_type& alloc );
+   ParseError( ParseError&& other, const allocator_type& alloc );
    ParseError& operator=( const ParseError& ) = default;
    ParseError& operator=( ParseError&& ) = default;
 
@@ -73,21 +87,39 @@ private:
       void clear();
    };
 
+   // The memory for the errors and the ignored arguments.  It is created with
+   // the first error or ignored argument, so a clean parse does not allocate
+   // it, and released in one step when the result is cleared or destroyed.
+   struct Arena
+   {
+      std::array<std::byte, 512> buffer;
+      std::pmr::monotonic_buffer_resource resource;
+
+      explicit Arena( std::pmr::memory_resource* pUpstream );
+   };
+
 private:
    bool exitRequested = false;
    bool helpWasShown = false;
    bool errorsWereShown = false;
    mutable RequireCheck mustCheck;
 
+   // The arena must outlive the containers that use it.
+   std::pmr::memory_resource* mpUpstream = nullptr;
+   std::unique_ptr<Arena> mpArena;
+
 public:
-   std::vector<std::string> ignoredArguments;
-   std::vector<ParseError> errors;
+   std::pmr::vector<std::pmr::string> ignoredArguments;
+   std::pmr::vector<ParseError> errors;
    std::vector<std::shared_ptr<CommandOptions>> commands;
 
 public:
-   ParseResult() = default;
+   // Create a result whose arena allocates from @p pUpstream when its initial
+   // buffer is exhausted.  The default memory resource is used if @p pUpstream
+   // is not set.
+   explicit ParseResult( std::pmr::memory_resource* pUpstream = nullptr );
    ParseResult( ParseResult&& ) = default;
-   ParseResult& operator=( ParseResult&& ) = default;
+   ParseResult& operator=( ParseResult&& other );
 
    ~ParseResult() noexcept( false );
    bool has_exited() const;
@@ -99,6 +131,7 @@ public:
 
 private:
    void clear();
+   void ensureArena();
 };
 
 class ParseResultBuilder
@@ -106,15 +139,19 @@ class ParseResultBuilder
    ParseResult mResult;
 
 public:
+   explicit ParseResultBuilder( std::pmr::memory_resource* pUpstream = nullptr );
    void clear();
    bool wasExitRequested() const;
    void addError( std::string_view optionName, int error );
+   void addError( std::string_view optionName, int error,
+         const std::vector<std::string_view>& suggestions );
    void addIgnored( std::string_view arg );
    void addCommand( const std::shared_ptr<CommandOptions>& pCommand );
    void requestExit();
    void signalHelpShown();
    void signalErrorsShown();
    ParseResult&& getResult();
+   const ParseResult& peekResult() const;
    bool hasArgumentProblems() const;
    void addResult( ParseResult&& result );
 };
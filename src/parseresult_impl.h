@@ -9,16 +9,33 @@
 
 namespace argumentum {
 
-ARGUMENTUM_INLINE ParseError::ParseError( std::string_view optionName, int code )
-   : option( optionName )
+ARGUMENTUM_INLINE ParseError::ParseError(
+      std::string_view optionName, int code, const allocator_type& alloc )
+   : option( optionName, alloc )
    , errorCode( code )
+   , suggestions( alloc )
+{}
+
+ARGUMENTUM_INLINE ParseError::ParseError( const ParseError& other, const allocator_type& alloc )
+   : option( other.option, alloc )
+   , errorCode( other.errorCode )
+   , suggestions( other.suggestions, alloc )
+{}
+
+ARGUMENTUM_INLINE ParseError::ParseError( ParseError&& other, const allocator_type& alloc )
+   : option( other.option, alloc )
+   , errorCode( other.errorCode )
+   , suggestions( std::move( other.suggestions ), alloc )
 {}
 
 ARGUMENTUM_INLINE void ParseError::describeError( std::ostream& stream ) const
 {
    switch ( errorCode ) {
       case UNKNOWN_OPTION:
-         stream << "Error: Unknown option: '" << option << "'\n";
+         stream << "Error: Unknown option: '" << option << "'";
+         for ( size_t i = 0; i < suggestions.size(); ++i )
+            stream << ( i == 0 ? ". Did you mean '" : "' or '" ) << suggestions[i];
+         stream << ( suggestions.empty() ? "\n" : "'?\n" );
          break;
       case EXCLUSIVE_OPTION:
          stream << "Error: Only one option from an exclusive group can be set. '" << option
@@ -93,6 +110,40 @@ ARGUMENTUM_INLINE void ParseResult::RequireCheck::clear()
    required = false;
 }
 
+ARGUMENTUM_INLINE ParseResult::Arena::Arena( std::pmr::memory_resource* pUpstream )
+   : resource( buffer.data(), buffer.size(),
+         pUpstream ? pUpstream : std::pmr::get_default_resource() )
+{}
+
+ARGUMENTUM_INLINE ParseResult::ParseResult( std::pmr::memory_resource* pUpstream )
+   : mpUpstream( pUpstream )
+{}
+
+ARGUMENTUM_INLINE ParseResult& ParseResult::operator=( ParseResult&& other )
+{
+   if ( this == &other )
+      return *this;
+
+   // The allocator of a pmr container can not be replaced by assignment.  The
+   // containers are rebuilt with the arena of @p other before the current
+   // arena is dropped.
+   using ignored_t = decltype( ignoredArguments );
+   using errors_t = decltype( errors );
+   ignoredArguments.~ignored_t();
+   new ( &ignoredArguments ) ignored_t( std::move( other.ignoredArguments ) );
+   errors.~errors_t();
+   new ( &errors ) errors_t( std::move( other.errors ) );
+   mpUpstream = other.mpUpstream;
+   mpArena = std::move( other.mpArena );
+
+   commands = std::move( other.commands );
+   exitRequested = other.exitRequested;
+   helpWasShown = other.helpWasShown;
+   errorsWereShown = other.errorsWereShown;
+   mustCheck = std::move( other.mustCheck );
+   return *this;
+}
+
 ARGUMENTUM_INLINE ParseResult::~ParseResult() noexcept( false )
 {}
 
@@ -119,10 +170,45 @@ ARGUMENTUM_INLINE ParseResult::operator bool() const
 
 ARGUMENTUM_INLINE void ParseResult::clear()
 {
-   ignoredArguments.clear();
-   errors.clear();
+   // The containers are emptied before the arena is released.  The initial
+   // buffer of the arena is reused by the next parse.
+   if ( mpArena ) {
+      auto pResource = &mpArena->resource;
+      decltype( ignoredArguments )( pResource ).swap( ignoredArguments );
+      decltype( errors )( pResource ).swap( errors );
+      mpArena->resource.release();
+   }
+   else {
+      ignoredArguments.clear();
+      errors.clear();
+   }
+
+   // The commands keep their capacity.
+   commands.clear();
    mustCheck.clear();
    exitRequested = false;
+   helpWasShown = false;
+   errorsWereShown = false;
+}
+
+// The containers are rebuilt with the allocator of the new arena.  They are
+// usually empty at this point.
+ARGUMENTUM_INLINE void ParseResult::ensureArena()
+{
+   if ( mpArena )
+      return;
+
+   mpArena = std::make_unique<Arena>( mpUpstream );
+   auto pResource = &mpArena->resource;
+
+   using ignored_t = decltype( ignoredArguments );
+   using errors_t = decltype( errors );
+   ignored_t ignored( std::move( ignoredArguments ), pResource );
+   ignoredArguments.~ignored_t();
+   new ( &ignoredArguments ) ignored_t( std::move( ignored ) );
+   errors_t errs( std::move( errors ), pResource );
+   errors.~errors_t();
+   new ( &errors ) errors_t( std::move( errs ) );
 }
 
 ARGUMENTUM_INLINE std::shared_ptr<CommandOptions> ParseResult::findCommand( std::string_view name )
@@ -134,6 +220,10 @@ ARGUMENTUM_INLINE std::shared_ptr<CommandOptions> ParseResult::findCommand( std:
    return nullptr;
 }
 
+ARGUMENTUM_INLINE ParseResultBuilder::ParseResultBuilder( std::pmr::memory_resource* pUpstream )
+   : mResult( pUpstream )
+{}
+
 ARGUMENTUM_INLINE void ParseResultBuilder::clear()
 {
    mResult.clear();
@@ -146,12 +236,24 @@ ARGUMENTUM_INLINE bool ParseResultBuilder::wasExitRequested() const
 
 ARGUMENTUM_INLINE void ParseResultBuilder::addError( std::string_view optionName, int error )
 {
+   mResult.ensureArena();
    mResult.errors.emplace_back( optionName, error );
    mResult.mustCheck.activate();
 }
 
+ARGUMENTUM_INLINE void ParseResultBuilder::addError( std::string_view optionName, int error,
+      const std::vector<std::string_view>& suggestions )
+{
+   addError( optionName, error );
+   auto& added = mResult.errors.back().suggestions;
+   added.reserve( suggestions.size() );
+   for ( auto name : suggestions )
+      added.emplace_back( name );
+}
+
 ARGUMENTUM_INLINE void ParseResultBuilder::addIgnored( std::string_view arg )
 {
+   mResult.ensureArena();
    mResult.ignoredArguments.emplace_back( arg );
 }
 
@@ -182,6 +284,11 @@ ARGUMENTUM_INLINE ParseResult&& ParseResultBuilder::getResult()
    return std::move( mResult );
 }
 
+ARGUMENTUM_INLINE const ParseResult& ParseResultBuilder::peekResult() const
+{
+   return mResult;
+}
+
 ARGUMENTUM_INLINE bool ParseResultBuilder::hasArgumentProblems() const
 {
    return !mResult.errors.empty() || !mResult.ignoredArguments.empty();
@@ -196,6 +303,9 @@ ARGUMENTUM_INLINE void ParseResultBuilder::addResult( ParseResult&& result )
    mResult.mustCheck.required |= result.mustCheck.required;
    result.mustCheck.required = false;
 
+   if ( !result.errors.empty() || !result.ignoredArguments.empty() )
+      mResult.ensureArena();
+
    for ( auto&& error : result.errors )
       mResult.errors.push_back( std::move( error ) );
 
@@ -0,0 +1,85 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "argumentstream.h"
+#include "parsecontext.h"
+#include "parseresult.h"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace argumentum {
+
+class argument_parser;
+
+/**
+ * A session parses input arguments with the same parser many times.  The
+ * definition of the parser is verified once, when the session is created, and
+ * the result of parsing is kept in the session so that its buffers are reused
+ * by the next parse.
+ *
+ * The definition of the parser must be complete before the session is created.
+ * The parser must outlive the session.
+ *
+ * The state of parsing is kept in the session and the parser is not modified
+ * while the arguments are parsed.  Multiple sessions can parse with the same
+ * parser in different threads if each session sets its own targets.  The
+ * first session must be created before the parser is shared between threads.
+ */
+class parse_session
+{
+   argument_parser& mParser;
+   ParseContext mContext;
+   ParseResultBuilder mResult;
+
+public:
+   // Create a session that sets the targets bound to the parser.
+   explicit parse_session( argument_parser& parser );
+
+   /**
+    * Create a session that sets the members of @p targets instead of the
+    * members of @p prototype.  The prototype is the structure that holds the
+    * targets that were bound to the parser.  Targets outside of the prototype
+    * are shared with the parser.
+    */
+   template<typename TTargets>
+   parse_session( argument_parser& parser, const TTargets& prototype, TTargets& targets )
+      : parse_session( parser, TargetBinding( prototype, targets ) )
+   {}
+
+   // Parse input arguments.  The result is valid until the next parse.
+   const ParseResult& parse_args( int argc, char** argv, int skip_args = 1 );
+
+   // Parse input arguments.  The result is valid until the next parse.
+   const ParseResult& parse_args( const std::vector<std::string>& args, int skip_args = 0 );
+
+   // Parse input arguments.  The result is valid until the next parse.
+   template<typename TView,
+         typename = std::enable_if_t<std::is_same_v<TView, std::string_view>>>
+   const ParseResult& parse_args( const std::vector<TView>& args, int skip_args = 0 )
+   {
+      auto ibegin = std::begin( args );
+      if ( skip_args > 0 )
+         ibegin += std::min<size_t>( skip_args, args.size() );
+
+      auto argStream = IteratorArgumentStream( ibegin, std::end( args ) );
+      return parse( argStream, ibegin == std::end( args ) );
+   }
+
+   // Parse input arguments.  The result is valid until the next parse.
+   const ParseResult& parse_args( ArgumentStream& args );
+
+   // The result of the last parse.
+   const ParseResult& result() const;
+
+private:
+   parse_session( argument_parser& parser, const TargetBinding& binding );
+   const ParseResult& parse( ArgumentStream& args, bool isEmpty );
+};
+
+}   // namespace argumentum
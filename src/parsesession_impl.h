@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "parsesession.h"
+
+#include "argparser.h"
+#include "parserdefinition.h"
+
+namespace argumentum {
+
+ARGUMENTUM_INLINE parse_session::parse_session( argument_parser& parser )
+   : parse_session( parser, TargetBinding{} )
+{}
+
+ARGUMENTUM_INLINE parse_session::parse_session(
+      argument_parser& parser, const TargetBinding& binding )
+   : mParser( parser )
+   , mContext( binding )
+   , mResult( parser.getConfig().memory_resource() )
+{
+   mParser.verifyDefinedOptions();
+   mContext.prepare( mParser.mParserDef );
+}
+
+ARGUMENTUM_INLINE const ParseResult& parse_session::parse_args(
+      int argc, char** argv, int skip_args )
+{
+   if ( !argv ) {
+      mResult.clear();
+      mResult.addError( "argv", INVALID_ARGV );
+      return mResult.peekResult();
+   }
+
+   auto count = std::max( 0, argc );
+   auto ibegin = argv + std::min( std::max( 0, skip_args ), count );
+   auto iend = argv + count;
+   auto argStream = ArgvArgumentStream( ibegin, iend );
+   return parse( argStream, ibegin == iend );
+}
+
+ARGUMENTUM_INLINE const ParseResult& parse_session::parse_args(
+      const std::vector<std::string>& args, int skip_args )
+{
+   auto ibegin = std::begin( args );
+   if ( skip_args > 0 )
+      ibegin += std::min<size_t>( skip_args, args.size() );
+
+   auto argStream = IteratorArgumentStream( ibegin, std::end( args ) );
+   return parse( argStream, ibegin == std::end( args ) );
+}
+
+ARGUMENTUM_INLINE const ParseResult& parse_session::parse_args( ArgumentStream& args )
+{
+   return parse( args, false );
+}
+
+ARGUMENTUM_INLINE const ParseResult& parse_session::result() const
+{
+   return mResult.peekResult();
+}
+
+ARGUMENTUM_INLINE const ParseResult& parse_session::parse( ArgumentStream& args, bool isEmpty )
+{
+   // The index is dropped when an option is renamed and the option table
+   // when an option is reconfigured.  They are rebuilt only in that case.
+   mParser.mParserDef.buildIndex();
+   mParser.mParserDef.assignSlots();
+   mParser.parseOrShowHelp( args, isEmpty, mContext, mResult );
+   return mResult.peekResult();
+}
+
+}   // namespace argumentum
@@ -0,0 +1,57 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "argumentstream.h"
+#include "mappedfilestream.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace argumentum {
+
+/**
+ * An implementation of ArgumentStream that splits text into arguments like
+ * the response files of GCC.  The arguments are separated by whitespace.
+ * Whitespace can be included in an argument if it is quoted with single or
+ * double quotes.  A backslash escapes the next character, also inside quotes.
+ *
+ * The text is scanned in 16 or 32 byte blocks where SSE2 or AVX2 is
+ * available.  An argument without quotes and escapes is returned as a view
+ * into the text.  Other arguments are copied into a buffer.  A returned view
+ * is valid until the next call to next().
+ */
+class QuotedArgumentStream : public ArgumentStream
+{
+   std::unique_ptr<MappedFile> mpFile;
+   std::string mOwnedText;
+   std::string_view mText;
+   size_t mPos = 0;
+   std::string mCurrent;
+
+public:
+   // Open the file @p filename.  A file of at least MappedFile::minMappedSize
+   // bytes is mapped into memory if possible, a smaller one is read into a
+   // string.  Returns nullptr if the file can not be read.
+   static std::unique_ptr<QuotedArgumentStream> open( const std::string& filename );
+
+   explicit QuotedArgumentStream( std::string text );
+   explicit QuotedArgumentStream( std::unique_ptr<MappedFile> pFile );
+
+   std::optional<std::string_view> next() override;
+   void peek( std::function<EPeekResult( std::string_view )> fnPeek ) override;
+
+private:
+   // Reads the argument that starts at or after @p pos.  The unescaped
+   // argument is stored in @p buffer if needed.  Returns the position after
+   // the argument or npos if there are no more arguments.
+   size_t scan( size_t pos, std::string_view& arg, std::string& buffer ) const;
+
+   // Returns the position of the first whitespace, quote or backslash at or
+   // after @p pos or the size of the text.
+   size_t findSpecial( size_t pos ) const;
+};
+
+}   // namespace argumentum
@@ -0,0 +1,216 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "quotedargumentstream.h"
+
+#include <fstream>
+#include <iterator>
+
+#if defined( __AVX2__ )
+#include <immintrin.h>
+#define ARGUMENTUM_SCAN_AVX2 1
+#elif defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#define ARGUMENTUM_SCAN_SSE2 1
+#endif
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+
+namespace argumentum {
+
+namespace quoted {
+inline bool isSpace( char c )
+{
+   auto u = static_cast<unsigned char>( c );
+   return u == ' ' || unsigned( u - '\t' ) <= unsigned( '\r' - '\t' );
+}
+
+inline bool isSpecial( char c )
+{
+   return isSpace( c ) || c == '"' || c == '\'' || c == '\\';
+}
+
+inline unsigned countTrailingZeros( unsigned mask )
+{
+#if defined( _MSC_VER ) && !defined( __clang__ )
+   unsigned long index;
+   _BitScanForward( &index, mask );
+   return index;
+#else
+   return static_cast<unsigned>( __builtin_ctz( mask ) );
+#endif
+}
+}   // namespace quoted
+
+ARGUMENTUM_INLINE std::unique_ptr<QuotedArgumentStream> QuotedArgumentStream::open(
+      const std::string& filename )
+{
+   auto pFile = MappedFile::open( filename, MappedFile::minMappedSize );
+   if ( pFile )
+      return std::make_unique<QuotedArgumentStream>( std::move( pFile ) );
+
+   std::ifstream file( filename, std::ios::binary );
+   if ( !file )
+      return nullptr;
+
+   std::string text{ std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() };
+   return std::make_unique<QuotedArgumentStream>( std::move( text ) );
+}
+
+ARGUMENTUM_INLINE QuotedArgumentStream::QuotedArgumentStream( std::string text )
+   : mOwnedText( std::move( text ) )
+   , mText( mOwnedText )
+{}
+
+ARGUMENTUM_INLINE QuotedArgumentStream::QuotedArgumentStream( std::unique_ptr<MappedFile> pFile )
+   : mpFile( std::move( pFile ) )
+{
+   if ( mpFile )
+      mText = std::string_view( mpFile->data(), mpFile->size() );
+}
+
+ARGUMENTUM_INLINE std::optional<std::string_view> QuotedArgumentStream::next()
+{
+   // The view returned by the previous call to next() is no longer used.
+   if ( mpFile )
+      mpFile->releaseBefore( mPos );
+
+   std::string_view arg;
+   auto end = scan( mPos, arg, mCurrent );
+   if ( end == std::string_view::npos ) {
+      mPos = mText.size();
+      return {};
+   }
+
+   mPos = end;
+   return arg;
+}
+
+ARGUMENTUM_INLINE void QuotedArgumentStream::peek(
+      std::function<EPeekResult( std::string_view )> fnPeek )
+{
+   if ( !fnPeek )
+      return;
+
+   std::string buffer;
+   std::string_view arg;
+   for ( auto pos = scan( mPos, arg, buffer ); pos != std::string_view::npos;
+         pos = scan( pos, arg, buffer ) ) {
+      if ( fnPeek( arg ) == peekDone )
+         break;
+   }
+}
+
+ARGUMENTUM_INLINE size_t QuotedArgumentStream::scan(
+      size_t pos, std::string_view& arg, std::string& buffer ) const
+{
+   auto size = mText.size();
+   while ( pos < size && quoted::isSpace( mText[pos] ) )
+      ++pos;
+
+   if ( pos >= size )
+      return std::string_view::npos;
+
+   // Most arguments are returned without copying.
+   auto start = pos;
+   pos = findSpecial( pos );
+   if ( pos == size || quoted::isSpace( mText[pos] ) ) {
+      arg = mText.substr( start, pos - start );
+      return pos;
+   }
+
+   buffer.assign( mText.data() + start, pos - start );
+   while ( pos < size ) {
+      auto c = mText[pos];
+      if ( quoted::isSpace( c ) )
+         break;
+
+      if ( c == '\\' ) {
+         if ( pos + 1 < size )
+            buffer.push_back( mText[pos + 1] );
+         pos += 2;
+      }
+      else if ( c == '"' || c == '\'' ) {
+         auto quote = c;
+         for ( ++pos; pos < size; ++pos ) {
+            c = mText[pos];
+            if ( c == quote ) {
+               ++pos;
+               break;
+            }
+            if ( c == '\\' && pos + 1 < size )
+               c = mText[++pos];
+            buffer.push_back( c );
+         }
+      }
+      else {
+         auto end = findSpecial( pos );
+         buffer.append( mText.data() + pos, end - pos );
+         pos = end;
+      }
+   }
+
+   arg = buffer;
+   return std::min( pos, size );
+}
+
+ARGUMENTUM_INLINE size_t QuotedArgumentStream::findSpecial( size_t pos ) const
+{
+   auto pData = mText.data();
+   auto size = mText.size();
+
+#if defined( ARGUMENTUM_SCAN_AVX2 )
+   const auto space = _mm256_set1_epi8( ' ' );
+   const auto dquote = _mm256_set1_epi8( '"' );
+   const auto squote = _mm256_set1_epi8( '\'' );
+   const auto backslash = _mm256_set1_epi8( '\\' );
+   const auto tab = _mm256_set1_epi8( '\t' );
+   const auto controlRange = _mm256_set1_epi8( '\r' - '\t' );
+   for ( ; pos + 32 <= size; pos += 32 ) {
+      auto block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( pData + pos ) );
+      // The characters from \t to \r are mapped to 0..4.
+      auto shifted = _mm256_sub_epi8( block, tab );
+      auto control = _mm256_cmpeq_epi8( _mm256_min_epu8( shifted, controlRange ), shifted );
+      auto quotes = _mm256_or_si256(
+            _mm256_cmpeq_epi8( block, dquote ), _mm256_cmpeq_epi8( block, squote ) );
+      auto other = _mm256_or_si256(
+            _mm256_cmpeq_epi8( block, space ), _mm256_cmpeq_epi8( block, backslash ) );
+      auto mask = static_cast<unsigned>( _mm256_movemask_epi8(
+            _mm256_or_si256( control, _mm256_or_si256( quotes, other ) ) ) );
+      if ( mask )
+         return pos + quoted::countTrailingZeros( mask );
+   }
+#elif defined( ARGUMENTUM_SCAN_SSE2 )
+   const auto space = _mm_set1_epi8( ' ' );
+   const auto dquote = _mm_set1_epi8( '"' );
+   const auto squote = _mm_set1_epi8( '\'' );
+   const auto backslash = _mm_set1_epi8( '\\' );
+   const auto tab = _mm_set1_epi8( '\t' );
+   const auto controlRange = _mm_set1_epi8( '\r' - '\t' );
+   for ( ; pos + 16 <= size; pos += 16 ) {
+      auto block = _mm_loadu_si128( reinterpret_cast<const __m128i*>( pData + pos ) );
+      // The characters from \t to \r are mapped to 0..4.
+      auto shifted = _mm_sub_epi8( block, tab );
+      auto control = _mm_cmpeq_epi8( _mm_min_epu8( shifted, controlRange ), shifted );
+      auto quotes =
+            _mm_or_si128( _mm_cmpeq_epi8( block, dquote ), _mm_cmpeq_epi8( block, squote ) );
+      auto other =
+            _mm_or_si128( _mm_cmpeq_epi8( block, space ), _mm_cmpeq_epi8( block, backslash ) );
+      auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8( _mm_or_si128( control, _mm_or_si128( quotes, other ) ) ) );
+      if ( mask )
+         return pos + quoted::countTrailingZeros( mask );
+   }
+#endif
+
+   while ( pos < size && !quoted::isSpecial( pData[pos] ) )
+      ++pos;
+
+   return pos;
+}
+
+}   // namespace argumentum
@@ -0,0 +1,693 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#pragma once
+
+#include "argumentlexer.h"
+#include "argumentstream.h"
+#include "convert.h"
+#include "parseresult.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace argumentum {
+
+// The properties of a parameter of a static_parser that do not depend on the
+// type of the target.
+struct StaticParameterInfo
+{
+   std::string_view shortName;
+   std::string_view longName;
+   int minArgs = 0;
+   int maxArgs = 0;
+   bool isRequired = false;
+   bool isPositional = false;
+
+   constexpr std::string_view getHelpName() const
+   {
+      return longName.empty() ? shortName : longName;
+   }
+};
+
+// A parameter of a static_parser.  It stores the value of the parameter in
+// the member @p pTarget of the options structure TOptions.  Parameters are
+// created with static_option or static_positional and configured with the
+// constexpr methods nargs, minargs, maxargs and required that have the same
+// meaning as the methods of OptionConfigA.
+template<typename TOptions, typename TTarget>
+struct StaticParameter
+{
+   using options_type = TOptions;
+   using target_type = TTarget;
+
+   StaticParameterInfo info;
+   TTarget TOptions::*pTarget = nullptr;
+
+   constexpr StaticParameter nargs( int count ) const
+   {
+      auto param = *this;
+      param.info.minArgs = count < 0 ? 0 : count;
+      param.info.maxArgs = param.info.minArgs;
+      return param;
+   }
+
+   constexpr StaticParameter minargs( int count ) const
+   {
+      auto param = *this;
+      param.info.minArgs = count < 0 ? 0 : count;
+      param.info.maxArgs = -1;
+      return param;
+   }
+
+   constexpr StaticParameter maxargs( int count ) const
+   {
+      auto param = *this;
+      param.info.minArgs = 0;
+      param.info.maxArgs = count < 0 ? 0 : count;
+      return param;
+   }
+
+   constexpr StaticParameter required( bool isRequired = true ) const
+   {
+      auto param = *this;
+      param.info.isRequired = isRequired;
+      return param;
+   }
+};
+
+namespace staticparser {
+
+template<typename T>
+struct is_vector : std::false_type
+{};
+
+template<typename T>
+struct is_vector<std::vector<T>> : std::true_type
+{};
+
+template<typename T>
+struct is_optional_vector : std::false_type
+{};
+
+template<typename T>
+struct is_optional_vector<std::optional<std::vector<T>>> : std::true_type
+{};
+
+// The default argument counts are the same as in argument_parser.  Options
+// are flags unless the target is a vector.  Positional parameters accept one
+// value unless the target is a vector.
+template<typename TTarget>
+constexpr StaticParameterInfo defaultInfo( bool isPositional )
+{
+   StaticParameterInfo info;
+   info.isPositional = isPositional;
+   info.isRequired = isPositional;
+   if ( is_vector<TTarget>::value ) {
+      info.minArgs = isPositional ? 0 : 1;
+      info.maxArgs = -1;
+   }
+   else if ( is_optional_vector<TTarget>::value ) {
+      info.minArgs = 0;
+      info.maxArgs = -1;
+   }
+   else if ( isPositional ) {
+      info.minArgs = 1;
+      info.maxArgs = 1;
+   }
+   return info;
+}
+
+constexpr bool isShortName( std::string_view name )
+{
+   return name.size() == 2 && name[0] == '-' && name[1] != '-';
+}
+
+constexpr bool isLongName( std::string_view name )
+{
+   return name.size() > 2 && name[0] == '-' && name[1] == '-';
+}
+
+struct NameEntry
+{
+   std::string_view name;
+   size_t index = 0;
+};
+
+template<size_t N>
+constexpr size_t countNames( const std::array<StaticParameterInfo, N>& infos )
+{
+   size_t count = 0;
+   for ( auto& info : infos ) {
+      if ( info.isPositional )
+         continue;
+      count += info.shortName.empty() ? 0 : 1;
+      count += info.longName.empty() ? 0 : 1;
+   }
+   return count;
+}
+
+template<size_t N>
+constexpr size_t countPositional( const std::array<StaticParameterInfo, N>& infos )
+{
+   size_t count = 0;
+   for ( auto& info : infos )
+      count += info.isPositional ? 1 : 0;
+   return count;
+}
+
+// All the option names sorted for binary search.
+template<size_t M, size_t N>
+constexpr std::array<NameEntry, M> makeSortedNames( const std::array<StaticParameterInfo, N>& infos )
+{
+   std::array<NameEntry, M> names{};
+   size_t count = 0;
+   auto insert = [&]( std::string_view name, size_t index ) {
+      auto pos = count++;
+      for ( ; pos > 0 && name < names[pos - 1].name; --pos )
+         names[pos] = names[pos - 1];
+      names[pos] = NameEntry{ name, index };
+   };
+
+   for ( size_t i = 0; i < N; ++i ) {
+      if ( infos[i].isPositional )
+         continue;
+      if ( !infos[i].shortName.empty() )
+         insert( infos[i].shortName, i );
+      if ( !infos[i].longName.empty() )
+         insert( infos[i].longName, i );
+   }
+   return names;
+}
+
+// The indices of options with short names indexed by the character of the
+// short name.  Used for short options and short option bundles.
+template<size_t N>
+constexpr std::array<int, 256> makeShortIndex( const std::array<StaticParameterInfo, N>& infos )
+{
+   std::array<int, 256> index{};
+   for ( auto& v : index )
+      v = -1;
+   for ( size_t i = 0; i < N; ++i ) {
+      auto& info = infos[i];
+      if ( info.isPositional )
+         continue;
+      if ( isShortName( info.shortName ) )
+         index[static_cast<unsigned char>( info.shortName[1] )] = int( i );
+   }
+   return index;
+}
+
+// The indices of positional parameters in the order of definition.
+template<size_t M, size_t N>
+constexpr std::array<size_t, M> makePositional( const std::array<StaticParameterInfo, N>& infos )
+{
+   std::array<size_t, M> positional{};
+   size_t count = 0;
+   for ( size_t i = 0; i < N; ++i )
+      if ( infos[i].isPositional )
+         positional[count++] = i;
+   return positional;
+}
+
+template<size_t N>
+constexpr bool hasValidNames( const std::array<StaticParameterInfo, N>& infos )
+{
+   for ( auto& info : infos ) {
+      if ( info.isPositional ) {
+         if ( info.longName.empty() || info.longName[0] == '-' )
+            return false;
+         continue;
+      }
+      if ( info.shortName.empty() && info.longName.empty() )
+         return false;
+      if ( !info.shortName.empty() && !isShortName( info.shortName ) )
+         return false;
+      if ( !info.longName.empty() && !isLongName( info.longName ) )
+         return false;
+   }
+   return true;
+}
+
+template<size_t M>
+constexpr bool hasUniqueNames( const std::array<NameEntry, M>& names )
+{
+   for ( size_t i = 1; i < M; ++i )
+      if ( names[i].name == names[i - 1].name )
+         return false;
+   return true;
+}
+
+}   // namespace staticparser
+
+// Create an option of a static_parser with a single name.  A name with one
+// dash and one character is a short name, otherwise it must be a long name
+// that starts with two dashes.
+template<typename TOptions, typename TTarget>
+constexpr StaticParameter<TOptions, TTarget> static_option(
+      std::string_view name, TTarget TOptions::*pTarget )
+{
+   auto info = staticparser::defaultInfo<TTarget>( false );
+   if ( staticparser::isShortName( name ) )
+      info.shortName = name;
+   else
+      info.longName = name;
+   return { info, pTarget };
+}
+
+// Create an option of a static_parser with a short name like -x and a long
+// name like --name.
+template<typename TOptions, typename TTarget>
+constexpr StaticParameter<TOptions, TTarget> static_option(
+      std::string_view shortName, std::string_view longName, TTarget TOptions::*pTarget )
+{
+   auto info = staticparser::defaultInfo<TTarget>( false );
+   info.shortName = shortName;
+   info.longName = longName;
+   return { info, pTarget };
+}
+
+// Create a positional parameter of a static_parser.
+template<typename TOptions, typename TTarget>
+constexpr StaticParameter<TOptions, TTarget> static_positional(
+      std::string_view name, TTarget TOptions::*pTarget )
+{
+   auto info = staticparser::defaultInfo<TTarget>( true );
+   info.longName = name;
+   return { info, pTarget };
+}
+
+// The table of parameters of a static_parser.  It is created with
+// make_static_schema.
+template<typename TOptions, typename... TTargets>
+struct StaticSchema
+{
+   using options_type = TOptions;
+   static constexpr size_t size = sizeof...( TTargets );
+
+   std::tuple<StaticParameter<TOptions, TTargets>...> parameters;
+
+   constexpr std::array<StaticParameterInfo, size> getInfos() const
+   {
+      return std::apply(
+            []( const auto&... param ) {
+               return std::array<StaticParameterInfo, size>{ param.info... };
+            },
+            parameters );
+   }
+};
+
+template<typename TOptions, typename... TTargets>
+constexpr StaticSchema<TOptions, TTargets...> make_static_schema(
+      StaticParameter<TOptions, TTargets>... parameters )
+{
+   return { std::make_tuple( parameters... ) };
+}
+
+/**
+ * A parser for a set of parameters that is fixed at compile time.
+ *
+ * The parameters are defined in a constexpr table that is stored in the
+ * static member `parameters` of the class TSchema:
+ *
+ *    struct Schema
+ *    {
+ *       static constexpr auto parameters = make_static_schema(
+ *             static_option( "-v", "--verbose", &Options::verbose ),
+ *             static_option( "--depth", &Options::depth ).nargs( 1 ),
+ *             static_positional( "files", &Options::files ) );
+ *    };
+ *
+ *    static_parser<Schema> parser;
+ *    auto res = parser.parse_args( options, argc, argv );
+ *
+ * The tables for the lookup of names and short option bundles are built at
+ * compile time and the parser does not allocate memory except for errors and
+ * values of the targets.  The input arguments are processed like in
+ * argument_parser.  Help, commands, groups, actions, forwarded options and
+ * response files are not supported.
+ *
+ * The targets are not reset before parsing so their initial values are the
+ * default values.  A vector target is cleared when it receives the first value.
+ */
+template<typename TSchema>
+class static_parser
+{
+   using schema_type = std::decay_t<decltype( TSchema::parameters )>;
+
+public:
+   using options_type = typename schema_type::options_type;
+
+private:
+   static constexpr size_t paramCount = schema_type::size;
+   static constexpr std::array<StaticParameterInfo, paramCount> infos =
+         TSchema::parameters.getInfos();
+
+   static constexpr size_t nameCount = staticparser::countNames( infos );
+   static constexpr auto sortedNames = staticparser::makeSortedNames<nameCount>( infos );
+   static constexpr auto shortIndex = staticparser::makeShortIndex( infos );
+   static constexpr auto positional =
+         staticparser::makePositional<staticparser::countPositional( infos )>( infos );
+
+   static_assert( staticparser::hasValidNames( infos ),
+         "Options must have a short name like -x and/or a long name that starts with two dashes. "
+         "Positional parameters must have a name that does not start with a dash." );
+   static_assert( staticparser::hasUniqueNames( sortedNames ),
+         "The names of options must be unique." );
+
+public:
+   // Returns the index of the parameter with the name @p name in the schema or
+   // -1 if the option does not exist.
+   static constexpr int find_option( std::string_view name )
+   {
+      if ( staticparser::isShortName( name ) )
+         return shortIndex[static_cast<unsigned char>( name[1] )];
+
+      size_t lo = 0;
+      size_t hi = sortedNames.size();
+      while ( lo < hi ) {
+         auto mid = lo + ( hi - lo ) / 2;
+         if ( sortedNames[mid].name < name )
+            lo = mid + 1;
+         else
+            hi = mid;
+      }
+
+      if ( lo < sortedNames.size() && sortedNames[lo].name == name )
+         return int( sortedNames[lo].index );
+      return -1;
+   }
+
+   // Parse input arguments into @p options and return errors in a ParseResult.
+   ParseResult parse_args( options_type& options, int argc, char** argv, int skip_args = 1 ) const
+   {
+      if ( !argv ) {
+         auto res = ParseResultBuilder{};
+         res.addError( "argv", INVALID_ARGV );
+         return res.getResult();
+      }
+
+      auto count = argc < 0 ? 0 : argc;
+      auto skip = skip_args < 0 ? 0 : skip_args;
+      const char* const* iarg = argv + ( skip < count ? skip : count );
+      const char* const* iend = argv + count;
+      return parse( options, [&]() -> std::optional<std::string_view> {
+         if ( iarg == iend )
+            return {};
+         return *iarg++;
+      } );
+   }
+
+   // Parse input arguments into @p options and return errors in a ParseResult.
+   ParseResult parse_args(
+         options_type& options, const std::vector<std::string>& args, int skip_args = 0 ) const
+   {
+      auto iarg = std::begin( args );
+      if ( skip_args > 0 )
+         iarg += std::min<size_t>( skip_args, args.size() );
+      return parse( options, [&]() -> std::optional<std::string_view> {
+         if ( iarg == std::end( args ) )
+            return {};
+         return *iarg++;
+      } );
+   }
+
+   // Parse input arguments into @p options and return errors in a ParseResult.
+   ParseResult parse_args( options_type& options, ArgumentStream& args ) const
+   {
+      return parse( options, [&]() {
+         return args.next();
+      } );
+   }
+
+private:
+   // The state of a single call to parse_args.
+   struct ParseState
+   {
+      options_type& options;
+      ParseResultBuilder& result;
+      // Values assigned to a parameter since it was last started.
+      std::array<int, paramCount> currentCounts{};
+      // Values assigned to a parameter in this parse.
+      std::array<int, paramCount> totalCounts{};
+      int active = -1;
+      size_t position = 0;
+   };
+
+   template<typename TNext>
+   ParseResult parse( options_type& options, TNext&& next ) const
+   {
+      ParseResultBuilder result;
+      ParseState state{ options, result };
+      ArgumentLexer lexer;
+      bool ignoreOptions = false;
+
+      for ( auto optArg = next(); !!optArg; optArg = next() ) {
+         auto arg = *optArg;
+         if ( ignoreOptions ) {
+            addFreeArgument( state, arg );
+            continue;
+         }
+
+         auto token = lexer.lex( arg );
+         switch ( token.type ) {
+            case EArgumentType::endOfOptions:
+               closeOption( state );
+               ignoreOptions = true;
+               continue;
+
+            case EArgumentType::longOption:
+               startOption( state, token );
+               continue;
+
+            case EArgumentType::shortOption:
+            case EArgumentType::multiOption:
+               if ( token.isNumber ) {
+                  if ( state.active >= 0 ) {
+                     if ( willAcceptArgument( state, state.active ) ) {
+                        setValue( state, state.active, arg );
+                        if ( !willAcceptArgument( state, state.active ) )
+                           closeOption( state );
+                        continue;
+                     }
+                  }
+                  else if ( find_option( arg.substr( 0, 2 ) ) < 0 ) {
+                     addFreeArgument( state, arg );
+                     continue;
+                  }
+               }
+
+               if ( token.type == EArgumentType::shortOption )
+                  startOption( state, token );
+               else {
+                  for ( size_t i = 1; i < arg.size(); ++i )
+                     startShortOption( state, arg[i] );
+               }
+               continue;
+
+            default:
+               break;
+         }
+
+         if ( state.active >= 0 && willAcceptArgument( state, state.active ) ) {
+            setValue( state, state.active, arg );
+            if ( !willAcceptArgument( state, state.active ) )
+               closeOption( state );
+         }
+         else
+            addFreeArgument( state, arg );
+      }
+
+      closeOption( state );
+      reportMissingParameters( state );
+      return std::move( result.getResult() );
+   }
+
+   void startOption( ParseState& state, const ArgumentToken& token ) const
+   {
+      closeOption( state );
+
+      auto name = token.text;
+      std::optional<std::string_view> value;
+      if ( token.eqpos != std::string_view::npos ) {
+         name = token.text.substr( 0, token.eqpos );
+         value = token.text.substr( token.eqpos + 1 );
+      }
+
+      auto index = find_option( name );
+      if ( index < 0 ) {
+         state.result.addError( name, UNKNOWN_OPTION );
+         return;
+      }
+
+      activateOption( state, index );
+      if ( value && !value->empty() ) {
+         if ( state.active >= 0 && willAcceptArgument( state, index ) ) {
+            setValue( state, index, *value );
+            if ( !willAcceptArgument( state, index ) )
+               closeOption( state );
+         }
+         else
+            state.result.addError( infos[index].getHelpName(), FLAG_PARAMETER );
+      }
+   }
+
+   void startShortOption( ParseState& state, char name ) const
+   {
+      closeOption( state );
+
+      auto index = shortIndex[static_cast<unsigned char>( name )];
+      if ( index < 0 ) {
+         const char optionName[] = { '-', name };
+         state.result.addError( std::string_view( optionName, 2 ), UNKNOWN_OPTION );
+         return;
+      }
+
+      activateOption( state, index );
+   }
+
+   void activateOption( ParseState& state, int index ) const
+   {
+      state.currentCounts[index] = 0;
+      if ( willAcceptArgument( state, index ) )
+         state.active = index;
+      else
+         setValue( state, index, "1" );
+   }
+
+   void closeOption( ParseState& state ) const
+   {
+      if ( state.active < 0 )
+         return;
+
+      auto index = state.active;
+      state.active = -1;
+      if ( state.currentCounts[index] < infos[index].minArgs )
+         state.result.addError( infos[index].getHelpName(), MISSING_ARGUMENT );
+      else if ( state.currentCounts[index] == 0 )
+         assignMissingValue( state, index );
+   }
+
+   void addFreeArgument( ParseState& state, std::string_view arg ) const
+   {
+      while ( state.position < positional.size() ) {
+         auto index = int( positional[state.position] );
+         if ( willAcceptArgument( state, index ) ) {
+            setValue( state, index, arg );
+            return;
+         }
+         ++state.position;
+      }
+
+      state.result.addIgnored( arg );
+   }
+
+   void reportMissingParameters( ParseState& state ) const
+   {
+      for ( size_t i = 0; i < paramCount; ++i ) {
+         auto& info = infos[i];
+         if ( info.isPositional ) {
+            if ( state.currentCounts[i] < info.minArgs
+                  && ( info.isRequired || state.totalCounts[i] > 0 ) )
+               state.result.addError( info.getHelpName(), MISSING_ARGUMENT );
+         }
+         else if ( info.isRequired && state.totalCounts[i] == 0 )
+            state.result.addError( info.getHelpName(), MISSING_OPTION );
+      }
+   }
+
+   static bool willAcceptArgument( const ParseState& state, int index )
+   {
+      auto maxArgs = infos[index].maxArgs;
+      return maxArgs < 0 || state.currentCounts[index] < maxArgs;
+   }
+
+   void setValue( ParseState& state, int index, std::string_view value ) const
+   {
+      auto isFirst = state.totalCounts[index] == 0;
+      ++state.currentCounts[index];
+      ++state.totalCounts[index];
+      try {
+         visit( index, [&]( const auto& param ) {
+            assign( state.options.*param.pTarget, value, isFirst );
+         } );
+      }
+      catch ( const std::invalid_argument& ) {
+         state.result.addError( infos[index].getHelpName(), CONVERSION_ERROR );
+      }
+      catch ( const std::out_of_range& ) {
+         state.result.addError( infos[index].getHelpName(), CONVERSION_ERROR );
+      }
+   }
+
+   // An option that accepts zero arguments was used without arguments.  Like
+   // in argument_parser, a vector receives the flag value if it is empty and
+   // an optional vector is set to an empty vector.
+   void assignMissingValue( ParseState& state, int index ) const
+   {
+      visit( index, [&]( const auto& param ) {
+         auto& target = state.options.*param.pTarget;
+         using target_type = std::decay_t<decltype( target )>;
+         if constexpr ( staticparser::is_optional_vector<target_type>::value ) {
+            if ( !target.has_value() )
+               target.emplace();
+         }
+         else if ( state.totalCounts[index] == 0 )
+            setValue( state, index, "1" );
+      } );
+   }
+
+   template<typename TVar>
+   static void assign( std::vector<TVar>& var, std::string_view value, bool isFirst )
+   {
+      if ( isFirst )
+         var.clear();
+      var.push_back( convert_from_string<TVar>( value ) );
+   }
+
+   template<typename TVar>
+   static void assign( std::optional<std::vector<TVar>>& var, std::string_view value, bool isFirst )
+   {
+      if ( isFirst || !var.has_value() )
+         var.emplace();
+      var->push_back( convert_from_string<TVar>( value ) );
+   }
+
+   template<typename TVar>
+   static void assign( std::optional<TVar>& var, std::string_view value, bool )
+   {
+      var = convert_from_string<TVar>( value );
+   }
+
+   template<typename TVar>
+   static void assign( TVar& var, std::string_view value, bool )
+   {
+      static_assert( has_from_string<TVar>::value,
+            "The target type of a static_parser parameter needs a from_string converter." );
+      var = convert_from_string<TVar>( value );
+   }
+
+   // Calls @p fn with the parameter at @p index in the schema.
+   template<typename TFunc>
+   static void visit( int index, TFunc&& fn )
+   {
+      visit( index, fn, std::make_index_sequence<paramCount>{} );
+   }
+
+   template<typename TFunc, size_t... I>
+   static void visit( int index, TFunc& fn, std::index_sequence<I...> )
+   {
+      ( ( index == int( I ) ? fn( std::get<I>( TSchema::parameters.parameters ) ) : void() ),
+            ... );
+   }
+};
+
+}   // namespace argumentum
@@ -7,7 +7,9 @@
 #include "notifier.h"
 
 #include <functional>
+#include <memory>
 #include <string>
+#include <string_view>
 
 namespace argumentum {
 
@@ -30,6 +32,14 @@ using TargetId = std::pair<ValueTypeId, uintptr_t>;
 using AssignAction =
       std::function<void( Value& target, const std::string& value, Environment& env )>;
 
+/**
+ * The assign-action that receives the argument as a string view.  Values are
+ * set through this interface so that an argument is copied only when an
+ * action or a conversion requires a std::string.
+ */
+using AssignViewAction =
+      std::function<void( Value& target, std::string_view value, Environment& env )>;
+
 /**
  * The assign-default action is executed when an option with a default
  * (absent) value is not set through arguments.  The default value is
@@ -37,13 +47,45 @@ using AssignAction =
  */
 using AssignDefaultAction = std::function<void( Value& target )>;
 
+/**
+ * Binds the targets that are members of a prototype structure to the same
+ * members of another structure of the same type.  Targets outside of the
+ * prototype are not rebound.
+ */
+class TargetBinding
+{
+   uintptr_t mPrototype = 0;
+   size_t mSize = 0;
+   uintptr_t mTargets = 0;
+
+public:
+   TargetBinding() = default;
+
+   template<typename TTargets>
+   TargetBinding( const TTargets& prototype, TTargets& targets )
+      : mPrototype( reinterpret_cast<uintptr_t>( &prototype ) )
+      , mSize( sizeof( TTargets ) )
+      , mTargets( reinterpret_cast<uintptr_t>( &targets ) )
+   {}
+
+   template<typename TTarget>
+   TTarget& bind( TTarget& target ) const
+   {
+      auto address = reinterpret_cast<uintptr_t>( &target );
+      if ( address >= mPrototype && address + sizeof( TTarget ) <= mPrototype + mSize )
+         return *reinterpret_cast<TTarget*>( mTargets + ( address - mPrototype ) );
+
+      return target;
+   }
+};
+
 class Value
 {
    int mAssignCount = 0;
    bool mHasErrors = false;
 
 public:
-   void setValue( std::string_view value, AssignAction action, Environment& env );
+   void setValue( std::string_view value, const AssignViewAction& action, Environment& env );
    void setDefault( AssignDefaultAction action );
    /**
     * Called when an option expects 0 or more values, but none is given.
@@ -63,13 +105,26 @@ public:
    void onOptionStarted();
    void reset();
 
+   /**
+    * Prepare the target for @p count additional values.  Vector targets
+    * reserve the space so that the values are appended in bulk.
+    */
+   virtual void reserve( size_t count );
+
    virtual ValueId getValueId() const;
    virtual ValueTypeId getValueTypeId() const = 0;
    virtual TargetId getTargetId() const;
 
+   /**
+    * Create a copy of the value with its own assignment counters that sets
+    * the target selected by @p binding.  Returns nullptr if the value can not
+    * be copied.  In that case the value is shared between parse contexts.
+    */
+   virtual std::unique_ptr<Value> clone( const TargetBinding& binding ) const;
+
 protected:
-   virtual AssignAction getDefaultAction() = 0;
-   virtual AssignAction getMissingValueAction() = 0;
+   virtual AssignViewAction getDefaultAction() = 0;
+   virtual AssignViewAction getMissingValueAction() = 0;
    virtual void doReset();
 };
 
@@ -77,11 +132,12 @@ class VoidValue : public Value
 {
 public:
    ValueTypeId getValueTypeId() const override;
+   std::unique_ptr<Value> clone( const TargetBinding& binding ) const override;
    static VoidValue* value_cast( Value& value );
 
 protected:
-   AssignAction getDefaultAction() override;
-   AssignAction getMissingValueAction() override;
+   AssignViewAction getDefaultAction() override;
+   AssignViewAction getMissingValueAction() override;
 };
 
 template<typename T>
@@ -93,23 +149,6 @@ class ConvertedValue : public Value
    template<typename T>
    friend class ::argumentum::OptionConfigA;
 
-   // Check if std::string can be converted to TVal with argparse::from_string.
-   template<typename TVal>
-   struct has_from_string
-   {
-   private:
-      typedef char YesType[1];
-      typedef char NoType[2];
-
-      template<typename C>
-      static YesType& test( decltype( &C::convert ) );
-      template<typename C>
-      static NoType& test( ... );
-
-   public:
-      enum { value = sizeof( test<::argumentum::from_string<TVal>>( 0 ) ) == sizeof( YesType ) };
-   };
-
    // Check if std::string can be converted to TVal with constructors or
    // assignment operators.
    template<class TVal>
@@ -145,6 +184,11 @@ public:
       return std::make_pair( getValueTypeId(), reinterpret_cast<uintptr_t>( &mTarget ) );
    }
 
+   std::unique_ptr<Value> clone( const TargetBinding& binding ) const override
+   {
+      return std::make_unique<ConvertedValue<TTarget>>( binding.bind( mTarget ) );
+   }
+
    static ValueTypeId valueTypeId()
    {
       static char tid = 0;
@@ -160,18 +204,18 @@ public:
    }
 
 protected:
-   AssignAction getDefaultAction() override
+   AssignViewAction getDefaultAction() override
    {
-      return []( Value& value, const std::string& argument, Environment& ) {
+      return []( Value& value, std::string_view argument, Environment& ) {
          auto pConverted = ConvertedValue<TTarget>::value_cast( value );
          if ( pConverted )
             pConverted->assign( pConverted->mTarget, argument );
       };
    }
 
-   AssignAction getMissingValueAction() override
+   AssignViewAction getMissingValueAction() override
    {
-      return []( Value& value, const std::string& argument, Environment& ) {
+      return []( Value& value, std::string_view argument, Environment& ) {
          auto pConverted = ConvertedValue<TTarget>::value_cast( value );
          if ( pConverted )
             pConverted->assignMissing( pConverted->mTarget, argument );
@@ -183,8 +227,34 @@ protected:
       mTarget = TTarget{};
    }
 
+public:
+   void reserve( size_t count ) override
+   {
+      if ( count > 0 )
+         reserveTarget( mTarget, count );
+   }
+
+protected:
+   template<typename TVar>
+   void reserveTarget( std::vector<TVar>& var, size_t count )
+   {
+      var.reserve( var.size() + count );
+   }
+
+   template<typename TVar>
+   void reserveTarget( std::optional<std::vector<TVar>>& var, size_t count )
+   {
+      if ( !var.has_value() )
+         var = std::vector<TVar>{};
+      var->reserve( var->size() + count );
+   }
+
+   template<typename TVar>
+   void reserveTarget( TVar&, size_t )
+   {}
+
    template<typename TVar>
-   void assign( std::vector<TVar>& var, const std::string& value )
+   void assign( std::vector<TVar>& var, std::string_view value )
    {
       TVar target;
       assign( target, value );
@@ -192,7 +262,7 @@ protected:
    }
 
    template<typename TVar>
-   void assignMissing( std::vector<TVar>& var, const std::string& value )
+   void assignMissing( std::vector<TVar>& var, std::string_view value )
    {
       if ( var.empty() ) {
          TVar target;
@@ -202,25 +272,24 @@ protected:
    }
 
    template<typename TVar>
-   void assign( std::optional<std::vector<TVar>>& var, const std::string& value )
+   void assign( std::optional<std::vector<TVar>>& var, std::string_view value )
    {
       TVar target;
       assign( target, value );
       if ( !var.has_value() )
          var = std::vector<TVar>{};
-      std::cout << value << "\n";
       var->emplace_back( std::move( target ) );
    }
 
    template<typename TVar>
-   void assignMissing( std::optional<std::vector<TVar>>& var, const std::string& /*value*/ )
+   void assignMissing( std::optional<std::vector<TVar>>& var, std::string_view /*value*/ )
    {
       if ( !var.has_value() )
          var = std::vector<TVar>{};
    }
 
    template<typename TVar>
-   void assign( std::optional<TVar>& var, const std::string& value )
+   void assign( std::optional<TVar>& var, std::string_view value )
    {
       TVar target;
       assign( target, value );
@@ -228,34 +297,34 @@ protected:
    }
 
    template<typename TVar>
-   void assignMissing( std::optional<TVar>& var, const std::string& /*value*/ )
+   void assignMissing( std::optional<TVar>& var, std::string_view /*value*/ )
    {
       if ( !var.has_value() )
          var = TVar{};
    }
 
    template<typename TVar, std::enable_if_t<has_from_string<TVar>::value, int> = 0>
-   void assign( TVar& var, const std::string& value )
+   void assign( TVar& var, std::string_view value )
    {
-      var = ::argumentum::from_string<TVar>::convert( value );
+      var = ::argumentum::convert_from_string<TVar>( value );
    }
 
    template<typename TVar,
          std::enable_if_t<!has_from_string<TVar>::value && can_convert<TVar>::value, int> = 0>
-   void assign( TVar& var, const std::string& value )
+   void assign( TVar& var, std::string_view value )
    {
-      var = TVar{ value };
+      var = TVar{ std::string{ value } };
    }
 
    template<typename TVar,
          std::enable_if_t<!has_from_string<TVar>::value && !can_convert<TVar>::value, int> = 0>
-   void assign( TVar&, const std::string& value )
+   void assign( TVar&, std::string_view value )
    {
-      Notifier::warn( "Assignment is not implemented. ('" + value + "')" );
+      Notifier::warn( "Assignment is not implemented. ('" + std::string{ value } + "')" );
    }
 
    template<typename TVar>
-   void assignMissing( TVar& var, const std::string& value )
+   void assignMissing( TVar& var, std::string_view value )
    {
       if ( getAssignCount() == 0 )
          assign( var, value );
@@ -20,14 +20,22 @@ ARGUMENTUM_INLINE TargetId Value::getTargetId() const
    return std::make_pair( getValueTypeId(), 0 );
 }
 
+ARGUMENTUM_INLINE std::unique_ptr<Value> Value::clone( const TargetBinding& ) const
+{
+   return nullptr;
+}
+
 ARGUMENTUM_INLINE void Value::setValue(
-      std::string_view value, AssignAction action, Environment& env )
+      std::string_view value, const AssignViewAction& action, Environment& env )
 {
    ++mAssignCount;
-   if ( action == nullptr )
-      action = getDefaultAction();
    if ( action )
-      action( *this, std::string{ value }, env );
+      action( *this, value, env );
+   else {
+      auto defaultAction = getDefaultAction();
+      if ( defaultAction )
+         defaultAction( *this, value, env );
+   }
 }
 
 ARGUMENTUM_INLINE void Value::setDefault( AssignDefaultAction action )
@@ -43,8 +51,7 @@ ARGUMENTUM_INLINE void Value::setMissingValue( std::string_view flagValue, Envir
    auto action = getMissingValueAction();
    if ( action ) {
       ++mAssignCount;
-      std::string fv{ flagValue };
-      action( *this, fv, env );
+      action( *this, flagValue, env );
    }
 }
 
@@ -72,11 +79,19 @@ ARGUMENTUM_INLINE void Value::reset()
 ARGUMENTUM_INLINE void Value::doReset()
 {}
 
+ARGUMENTUM_INLINE void Value::reserve( size_t )
+{}
+
 ARGUMENTUM_INLINE uintptr_t VoidValue::getValueTypeId() const
 {
    return 0;
 }
 
+ARGUMENTUM_INLINE std::unique_ptr<Value> VoidValue::clone( const TargetBinding& ) const
+{
+   return std::make_unique<VoidValue>();
+}
+
 ARGUMENTUM_INLINE VoidValue* VoidValue::value_cast( Value& value )
 {
    if ( value.getValueTypeId() != 0 )
@@ -85,12 +100,12 @@ ARGUMENTUM_INLINE VoidValue* VoidValue::value_cast( Value& value )
    return static_cast<VoidValue*>( &value );
 }
 
-ARGUMENTUM_INLINE AssignAction VoidValue::getDefaultAction()
+ARGUMENTUM_INLINE AssignViewAction VoidValue::getDefaultAction()
 {
    return {};
 }
 
-ARGUMENTUM_INLINE AssignAction VoidValue::getMissingValueAction()
+ARGUMENTUM_INLINE AssignViewAction VoidValue::getMissingValueAction()
 {
    return {};
 }
@@ -4,21 +4,26 @@
 #pragma once
 
 #include <ostream>
-#include <regex>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace argumentum {
 
+/**
+ * Writes word wrapped text.  The text of each call is formatted into a buffer
+ * that is written to the stream in a single write at the end of the call.
+ */
 class Writer
 {
    std::ostream& stream;
+   std::string buffer;
    size_t position = 0;
    size_t lastWritePosition = 0;
    size_t width = 80;
    bool startOfParagraph = true;
-   std::string indent;
+   size_t indent = 0;
 
 public:
    Writer( std::ostream& outStream, size_t widthBytes = 80 );
@@ -36,6 +41,13 @@ public:
 
 private:
    void write_paragraph( std::string_view text );
+   void flush();
+
+   // Find the first paragraph break that starts at or after @p start.
+   // Returns the start and the end of the break or npos if there is none.
+   static std::pair<size_t, size_t> findParagraphBreak( std::string_view text, size_t start );
+   static bool isBlank( char ch );
+   static bool isSpace( char ch );
 };
 
 }   // namespace argumentum
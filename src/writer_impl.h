@@ -1,4 +1,4 @@
-﻿// Copyright (c) 2018, 2019, 2020 Marko Mahnič
+// Copyright (c) 2018, 2019, 2020 Marko Mahnič
 // License: MPL2. See LICENSE in the root of the project.
 
 #pragma once
@@ -12,31 +12,47 @@ ARGUMENTUM_INLINE Writer::Writer( std::ostream& outStream, size_t widthBytes )
 
 ARGUMENTUM_INLINE void Writer::setIndent( size_t indentBytes )
 {
-   if ( indentBytes > width )
-      indentBytes = width;
-   indent = indentBytes == 0 ? "" : std::string( indentBytes, ' ' );
+   indent = indentBytes > width ? width : indentBytes;
 }
 
 ARGUMENTUM_INLINE void Writer::write( std::string_view text )
 {
-   auto blocks = splitIntoParagraphs( text );
-   for ( auto block : blocks ) {
-      if ( block.empty() )
-         startParagraph();
-      else {
-         write_paragraph( block );
+   // The paragraphs are written as they are found in the text.
+   size_t start = 0;
+   while ( true ) {
+      auto [breakStart, breakEnd] = findParagraphBreak( text, start );
+      if ( breakStart == std::string_view::npos )
+         break;
+
+      if ( breakStart > start ) {
+         write_paragraph( text.substr( start, breakStart - start ) );
          startOfParagraph = false;
       }
+      if ( !startOfParagraph ) {
+         startLine();
+         buffer += '\n';
+         startOfParagraph = true;
+      }
+
+      start = breakEnd;
    }
+
+   if ( start < text.size() ) {
+      write_paragraph( text.substr( start ) );
+      startOfParagraph = false;
+   }
+
+   flush();
 }
 
 ARGUMENTUM_INLINE void Writer::startLine()
 {
    if ( position > 0 )
-      stream << "\n";
+      buffer += '\n';
    position = 0;
    lastWritePosition = 0;
    startOfParagraph = false;
+   flush();
 }
 
 ARGUMENTUM_INLINE void Writer::skipToColumnOrNewLine( size_t column )
@@ -44,19 +60,61 @@ ARGUMENTUM_INLINE void Writer::skipToColumnOrNewLine( size_t column )
    if ( column >= width || column < position )
       startLine();
    else if ( column > position ) {
-      stream << std::string( column - position, ' ' );
+      buffer.append( column - position, ' ' );
       position = column;
    }
    startOfParagraph = false;
+   flush();
 }
 
 ARGUMENTUM_INLINE void Writer::startParagraph()
 {
    if ( !startOfParagraph ) {
       startLine();
-      stream << "\n";
+      buffer += '\n';
       startOfParagraph = true;
    }
+   flush();
+}
+
+ARGUMENTUM_INLINE bool Writer::isBlank( char ch )
+{
+   return ch == ' ' || ch == '\t';
+}
+
+ARGUMENTUM_INLINE bool Writer::isSpace( char ch )
+{
+   return ch == ' ' || ( ch >= '\t' && ch <= '\r' );
+}
+
+// A paragraph break is a newline followed by blanks and another newline.  The
+// blanks before the first newline and all the whitespace after the second
+// newline are part of the break.  The newlines are found with memchr.
+ARGUMENTUM_INLINE std::pair<size_t, size_t> Writer::findParagraphBreak(
+      std::string_view text, size_t start )
+{
+   auto pos = start;
+   while ( ( pos = text.find( '\n', pos ) ) != std::string_view::npos ) {
+      auto end = pos + 1;
+      while ( end < text.size() && isBlank( text[end] ) )
+         ++end;
+
+      if ( end < text.size() && text[end] == '\n' ) {
+         ++end;
+         while ( end < text.size() && isSpace( text[end] ) )
+            ++end;
+
+         auto begin = pos;
+         while ( begin > start && isBlank( text[begin - 1] ) )
+            --begin;
+
+         return { begin, end };
+      }
+
+      ++pos;
+   }
+
+   return { std::string_view::npos, std::string_view::npos };
 }
 
 ARGUMENTUM_INLINE std::vector<std::string_view> Writer::splitIntoWords( std::string_view text )
@@ -65,11 +123,11 @@ ARGUMENTUM_INLINE std::vector<std::string_view> Writer::splitIntoWords( std::str
 
    size_t pos = 0;
    while ( pos < text.size() ) {
-      while ( pos < text.size() && iswspace( text[pos] ) )
+      while ( pos < text.size() && isSpace( text[pos] ) )
          ++pos;
 
       size_t end = pos;
-      while ( end < text.size() && !iswspace( text[end] ) )
+      while ( end < text.size() && !isSpace( text[end] ) )
          ++end;
 
       if ( end > pos )
@@ -83,50 +141,74 @@ ARGUMENTUM_INLINE std::vector<std::string_view> Writer::splitIntoWords( std::str
 
 ARGUMENTUM_INLINE std::vector<std::string_view> Writer::splitIntoParagraphs( std::string_view text )
 {
-   auto rxParagraph = std::regex( "[ \t]*\n[ \t]*\n\\s*" );
    std::vector<std::string_view> paragraphs;
 
-   auto it = std::cregex_iterator( text.data(), text.data() + text.size(), rxParagraph );
-   auto iend = std::cregex_iterator();
-   size_t lastPosition = 0;
-   for ( ; it != iend; ++it ) {
-      auto match = std::cmatch( *it );
-      if ( match.position() == 0 )
-         paragraphs.emplace_back();
-      else {
-         paragraphs.push_back( text.substr( lastPosition, match.position() - lastPosition ) );
-         paragraphs.emplace_back();
-      }
-      lastPosition = match.position() + match.length();
+   size_t start = 0;
+   while ( true ) {
+      auto [breakStart, breakEnd] = findParagraphBreak( text, start );
+      if ( breakStart == std::string_view::npos )
+         break;
+
+      if ( breakStart > 0 )
+         paragraphs.push_back( text.substr( start, breakStart - start ) );
+      paragraphs.emplace_back();
+      start = breakEnd;
    }
 
-   if ( lastPosition < text.size() )
-      paragraphs.push_back( text.substr( lastPosition ) );
+   if ( start < text.size() )
+      paragraphs.push_back( text.substr( start ) );
 
    return paragraphs;
 }
 
+// The words are appended to the buffer directly from the text.
 ARGUMENTUM_INLINE void Writer::write_paragraph( std::string_view text )
 {
-   auto words = splitIntoWords( text );
-   for ( auto word : words ) {
-      auto newpos = position + ( position == 0 ? indent.size() : 1 ) + word.size();
-      if ( newpos > width )
-         startLine();
+   size_t pos = 0;
+   while ( pos < text.size() ) {
+      while ( pos < text.size() && isSpace( text[pos] ) )
+         ++pos;
+
+      size_t end = pos;
+      while ( end < text.size() && !isSpace( text[end] ) )
+         ++end;
+
+      if ( end == pos )
+         break;
+
+      auto word = text.substr( pos, end - pos );
+      pos = end;
+
+      auto newpos = position + ( position == 0 ? indent : 1 ) + word.size();
+      if ( newpos > width ) {
+         if ( position > 0 )
+            buffer += '\n';
+         position = 0;
+         lastWritePosition = 0;
+      }
       else if ( position > 0 && position == lastWritePosition ) {
-         stream << " ";
+         buffer += ' ';
          ++position;
       }
 
-      if ( position == 0 && indent.size() > 0 ) {
-         stream << indent;
-         position = indent.size();
+      if ( position == 0 && indent > 0 ) {
+         buffer.append( indent, ' ' );
+         position = indent;
       }
 
-      stream.write( word.data(), word.size() );
+      buffer.append( word.data(), word.size() );
       position += word.size();
       lastWritePosition = position;
    }
 }
 
+ARGUMENTUM_INLINE void Writer::flush()
+{
+   if ( buffer.empty() )
+      return;
+
+   stream.write( buffer.data(), buffer.size() );
+   buffer.clear();
+}
+
 }   // namespace argumentum
@@ -247,3 +247,27 @@ TEST( ArgumentParserActionTest, shouldReportErrorsThroughActionEvnironment )
    EXPECT_NE( std::string::npos, res.errors[0].option.find( "--wrong" ) );
    EXPECT_NE( std::string::npos, res.errors[0].option.find( "Something is wrong" ) );
 }
+
+TEST( ArgumentParserActionTest, shouldPassStringViewsToViewActions )
+{
+   auto actionView = []( std::string& target, std::string_view value ) {
+      target = value.substr( 0, 3 );
+   };
+   auto actionViewEnv = []( std::string& target, std::string_view value, Environment& env ) {
+      target = std::string{ value } + env.get_option_name();
+   };
+
+   std::string result;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( result, "-v" ).maxargs( 1 ).action( actionView );
+   params.add_parameter( result, "-e" ).maxargs( 1 ).action( actionViewEnv );
+
+   auto res = parser.parse_args( { "-v", "abcdef" } );
+   EXPECT_TRUE( res.errors.empty() );
+   EXPECT_EQ( "abc", result );
+
+   res = parser.parse_args( { "-e", "value" } );
+   EXPECT_TRUE( res.errors.empty() );
+   EXPECT_EQ( "value-e", result );
+}
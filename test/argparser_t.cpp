@@ -163,6 +163,71 @@ TEST( ArgumentParserTest, shouldReportUnknownOptionError )
    ASSERT_EQ( 1, res.errors.size() );
    EXPECT_EQ( "--unknown", res.errors.front().option );
    EXPECT_EQ( UNKNOWN_OPTION, res.errors.front().errorCode );
+   EXPECT_TRUE( res.errors.front().suggestions.empty() );
+}
+
+TEST( ArgumentParserTest, shouldSuggestSimilarOptionsForUnknownOption )
+{
+   bool verbose = false;
+   bool force = false;
+   bool ignoreCase = false;
+   std::string colour;
+   std::string colours;
+   std::stringstream strout;
+
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_parameter( verbose, "-v", "--verbose" );
+   params.add_parameter( force, "-f", "--force" );
+   params.add_parameter( ignoreCase, "--ignore-case" );
+   params.add_parameter( colours, "--colours" ).nargs( 1 );
+   params.add_parameter( colour, "--colour" ).nargs( 1 );
+   params.add_command<CommandOptions>( "colors" );
+
+   // A swap of two characters is one edit.
+   auto res = parser.parse_args( { "--vrebose" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_TRUE( vector_eq( { "--verbose" }, res.errors.front().suggestions ) );
+   EXPECT_NE( std::string::npos, strout.str().find( "Did you mean '--verbose'?" ) );
+
+   // The names at the same distance are ordered alphabetically.
+   res = parser.parse_args( { "--colourx" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_TRUE( vector_eq( { "--colour", "--colours" }, res.errors.front().suggestions ) );
+
+   // The commands are not suggested.
+   res = parser.parse_args( { "--colors" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_TRUE( vector_eq( { "--colours" }, res.errors.front().suggestions ) );
+
+   // Two edits are allowed in names with at least eight characters after the
+   // dashes when no name is one edit away.
+   res = parser.parse_args( { "--ignroe-cse" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_TRUE( vector_eq( { "--ignore-case" }, res.errors.front().suggestions ) );
+
+   res = parser.parse_args( { "--clour" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_TRUE( vector_eq( { "--colour" }, res.errors.front().suggestions ) );
+
+   // Short names are too short to be similar.
+   res = parser.parse_args( { "-x", "--forced-update" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 2, res.errors.size() );
+   EXPECT_TRUE( res.errors[0].suggestions.empty() );
+   EXPECT_TRUE( res.errors[1].suggestions.empty() );
+
+   res = parser.parse_args( { "--forse=1" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_EQ( "--forse", res.errors.front().option );
+   EXPECT_TRUE( vector_eq( { "--force" }, res.errors.front().suggestions ) );
 }
 
 TEST( ArgumentParserTest, shouldReportMissingRequiredOptionError )
@@ -1192,6 +1257,26 @@ TEST( ArgumentParserTest, shouldShowHelpWhenHasRequiredArgumentsAndNoneAreGiven
    EXPECT_TRUE( res.help_was_shown() );
 }
 
+TEST( ArgumentParserTest, shouldResetTargetsChangedBetweenParses )
+{
+   int x = 0;
+   int y = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( x, "--x" ).nargs( 1 );
+   params.add_parameter( y, "--y" ).nargs( 1 );
+
+   auto res = parser.parse_args( { "--y", "2" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 2, y );
+
+   x = 7;
+   res = parser.parse_args( { "--y", "3" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 0, x );
+   EXPECT_EQ( 3, y );
+}
+
 TEST( ArgumentParserTest, shouldReturnDefaultValueIfOptionMissing )
 {
    std::stringstream strout;
@@ -1259,3 +1344,65 @@ TEST( ArgumentParserTest, shouldDetectOptionsWithSameTarget )
    EXPECT_TRUE( static_cast<bool>( res ) );
    EXPECT_EQ( 5, shared );
 }
+
+TEST( ArgumentParserTest, shouldParseArgcArgv )
+{
+   std::string value;
+   std::vector<std::string> free;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( value, "-v" ).nargs( 1 );
+   params.add_parameter( free, "free" ).minargs( 0 );
+
+   char program[] = "program";
+   char option[] = "-v";
+   char optionValue[] = "value";
+   char freeValue[] = "free";
+   char* argv[] = { program, option, optionValue, freeValue, nullptr };
+
+   auto res = parser.parse_args( 4, argv );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "value", value );
+   EXPECT_TRUE( vector_eq( { "free" }, free ) );
+
+   value.clear();
+   free.clear();
+   res = parser.parse_args( 4, argv, 2 );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "", value );
+   EXPECT_TRUE( vector_eq( { "value", "free" }, free ) );
+}
+
+TEST( ArgumentParserTest, shouldParseVectorOfStringViews )
+{
+   std::string value;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( value, "-v" ).nargs( 1 );
+
+   std::vector<std::string_view> args{ "program", "-v", "value" };
+   auto res = parser.parse_args( args, 1 );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "value", value );
+
+   // A braced list still selects the std::vector<std::string> overload.
+   value.clear();
+   res = parser.parse_args( { "-v", "other" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "other", value );
+}
+
+#ifdef ARGUMENTUM_HAS_SPAN
+TEST( ArgumentParserTest, shouldParseSpanOfCStrings )
+{
+   std::string value;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( value, "-v" ).nargs( 1 );
+
+   const char* argv[] = { "program", "-v", "value" };
+   auto res = parser.parse_args( std::span<const char* const>( argv ), 1 );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "value", value );
+}
+#endif
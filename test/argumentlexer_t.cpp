@@ -0,0 +1,101 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+#include <argumentum/../../src/argumentlexer.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <regex>
+#include <string>
+
+using namespace argumentum;
+
+namespace {
+// The regular expression that was used to detect numbers before the lexer was
+// introduced.
+bool isNumberLikeRx( std::string_view arg )
+{
+   static auto rxNumber = std::regex(
+         "^0b[01]+$"
+         "|"
+         "^0o[0-7]+$"
+         "|"
+         "^(0d)?[0-9]*\\.?[0-9]+([eE][-+]?[0-9]+)?$"
+         "|"
+         "^0x[0-9a-fA-F]*\\.?[0-9a-fA-F]+([pP][-+]?[0-9a-fA-F]+)?$" );
+   return std::regex_match( std::begin( arg ), std::end( arg ), rxNumber );
+}
+}   // namespace
+
+TEST( ArgumentLexer, shouldRecognizeNumbers )
+{
+   auto numbers = { "0", "5", "0123", "12.5", ".5", "1e5", "1E-5", "0e5", "1.5e+10", "0d12",
+      "0d.5", "0b1011", "0o17", "0x1f", "0xFF", "0x.8", "0x1.8p3", "0x1P-2", "0xep1" };
+   for ( auto number : numbers )
+      EXPECT_TRUE( ArgumentLexer::isNumberLike( number ) ) << number;
+
+   auto others = { "", "x", "1.", ".", "1.2.3", "1e", "1e+", "0d", "0de5", "0b", "0b12", "0o",
+      "0o8", "0x", "0x1.", "0xp1", "0X5", "0B1", "1a", "--1", "1,2", "1=2" };
+   for ( auto other : others )
+      EXPECT_FALSE( ArgumentLexer::isNumberLike( other ) ) << other;
+}
+
+TEST( ArgumentLexer, shouldRecognizeNumbersLikeTheRegularExpression )
+{
+   const std::string alphabet = "0123456789.+-bdeEoxpPaAfFz";
+   std::mt19937 rng( 42 );
+   std::uniform_int_distribution<size_t> pickLength( 0, 8 );
+   std::uniform_int_distribution<size_t> pickChar( 0, alphabet.size() - 1 );
+
+   for ( int i = 0; i < 20000; ++i ) {
+      std::string text;
+      // Start most strings with a prefix so that all the branches are tested.
+      auto prefix = i % 5;
+      if ( prefix > 0 )
+         text = std::string{ "0" } + "bodx"[prefix - 1];
+      auto length = pickLength( rng );
+      for ( size_t k = 0; k < length; ++k )
+         text.push_back( alphabet[pickChar( rng )] );
+
+      EXPECT_EQ( isNumberLikeRx( text ), ArgumentLexer::isNumberLike( text ) ) << text;
+   }
+}
+
+TEST( ArgumentLexer, shouldClassifyArguments )
+{
+   ArgumentLexer lexer;
+   EXPECT_EQ( EArgumentType::freeArgument, lexer.lex( "" ).type );
+   EXPECT_EQ( EArgumentType::freeArgument, lexer.lex( "free" ).type );
+   EXPECT_EQ( EArgumentType::freeArgument, lexer.lex( "-" ).type );
+   EXPECT_EQ( EArgumentType::include, lexer.lex( "@file" ).type );
+   EXPECT_EQ( EArgumentType::endOfOptions, lexer.lex( "--" ).type );
+   EXPECT_EQ( EArgumentType::longOption, lexer.lex( "--long" ).type );
+   EXPECT_EQ( EArgumentType::shortOption, lexer.lex( "-s" ).type );
+   EXPECT_EQ( EArgumentType::multiOption, lexer.lex( "-abc" ).type );
+
+   EXPECT_TRUE( lexer.lex( "-5" ).isNumber );
+   EXPECT_TRUE( lexer.lex( "-0x1f" ).isNumber );
+   EXPECT_FALSE( lexer.lex( "-abc" ).isNumber );
+   EXPECT_FALSE( lexer.lex( "--5" ).isNumber );
+}
+
+TEST( ArgumentLexer, shouldFindAssignmentAndCommaPositions )
+{
+   ArgumentLexer lexer;
+   auto token = lexer.lex( "--name=a,b=c" );
+   EXPECT_EQ( 6, token.eqpos );
+   EXPECT_EQ( 8, token.commapos );
+
+   token = lexer.lex( "--forward,--x=1" );
+   EXPECT_EQ( 13, token.eqpos );
+   EXPECT_EQ( 9, token.commapos );
+
+   token = lexer.lex( "--name" );
+   EXPECT_EQ( std::string_view::npos, token.eqpos );
+   EXPECT_EQ( std::string_view::npos, token.commapos );
+
+   token = lexer.lex( "-x=5" );
+   EXPECT_EQ( 2, token.eqpos );
+   EXPECT_FALSE( token.isNumber );
+}
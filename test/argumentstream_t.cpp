@@ -67,3 +67,78 @@ TEST( ArgumentStream, shouldCreateArgumentStreamFromStdStream )
    EXPECT_EQ( "two", res[1] );
    EXPECT_EQ( "three", res[2] );
 }
+
+TEST( ArgumentStream, shouldReadArgvWithoutCopying )
+{
+   const char* argv[] = { "one", "two", "three" };
+
+   ArgvArgumentStream stream( std::begin( argv ), std::end( argv ) );
+   std::vector<std::string_view> res;
+   for ( auto arg = stream.next(); !!arg; arg = stream.next() )
+      res.push_back( *arg );
+
+   ASSERT_EQ( 3, res.size() );
+
+   EXPECT_EQ( argv[0], res[0].data() );
+   EXPECT_EQ( argv[1], res[1].data() );
+   EXPECT_EQ( "three", res[2] );
+}
+
+namespace {
+std::vector<std::string> readQuoted( const std::string& text )
+{
+   QuotedArgumentStream stream( text );
+   std::vector<std::string> res;
+   for ( auto arg = stream.next(); !!arg; arg = stream.next() )
+      res.push_back( std::string{ *arg } );
+   return res;
+}
+}   // namespace
+
+TEST( ArgumentStream, shouldSplitQuotedArgumentsAtWhitespace )
+{
+   using strings = std::vector<std::string>;
+   EXPECT_EQ( strings{}, readQuoted( "" ) );
+   EXPECT_EQ( strings{}, readQuoted( " \t\r\n " ) );
+   EXPECT_EQ( ( strings{ "-O2", "-c", "a.c" } ), readQuoted( "  -O2\t-c\r\na.c\n" ) );
+   EXPECT_EQ( ( strings{ "-DNAME=a b", "c" } ), readQuoted( "-DNAME='a b' c" ) );
+   EXPECT_EQ( ( strings{ "say \"hi\"", "" } ), readQuoted( "\"say \\\"hi\\\"\" \"\"" ) );
+   EXPECT_EQ( ( strings{ "a b", "c\\d", "e'f" } ), readQuoted( "a\\ b c\\\\d \"e'f\"" ) );
+   EXPECT_EQ( ( strings{ "unterminated quote" } ), readQuoted( "'unterminated quote" ) );
+   EXPECT_EQ( ( strings{ "end" } ), readQuoted( "end\\" ) );
+}
+
+TEST( ArgumentStream, shouldFindSeparatorsAtEveryPositionOfABlock )
+{
+   // The separators and quotes are placed at every offset of the 16 and 32
+   // byte blocks that are scanned at once.
+   for ( size_t length = 1; length < 70; ++length ) {
+      auto word = std::string( length, 'x' );
+      auto text = word + " " + word + "\n'" + word + "' " + word + "\\ y";
+      auto res = readQuoted( text );
+      ASSERT_EQ( 4, res.size() ) << length;
+      EXPECT_EQ( word, res[0] );
+      EXPECT_EQ( word, res[1] );
+      EXPECT_EQ( word, res[2] );
+      EXPECT_EQ( word + " y", res[3] );
+   }
+}
+
+TEST( ArgumentStream, shouldPeekQuotedArguments )
+{
+   auto text = std::string{ "plain 'quoted'" };
+   QuotedArgumentStream stream( text );
+   auto first = stream.next();
+   ASSERT_TRUE( first.has_value() );
+   EXPECT_EQ( "plain", *first );
+
+   std::vector<std::string> peeked;
+   stream.peek( [&]( std::string_view arg ) {
+      peeked.emplace_back( arg );
+      return ArgumentStream::peekNext;
+   } );
+   EXPECT_EQ( std::vector<std::string>{ "quoted" }, peeked );
+
+   EXPECT_EQ( "quoted", stream.next().value_or( "" ) );
+   EXPECT_FALSE( stream.next().has_value() );
+}
@@ -338,3 +338,72 @@ TEST( ArgumentParserCommand, shouldAccessParentOptionsFromCommand )
    ASSERT_NE( nullptr, pCmdOne->mpGlobal );
    EXPECT_EQ( 5, pCmdOne->mpGlobal->global );
 }
+
+TEST( ArgumentParserCommand, shouldReuseTheCommandParserInLaterParses )
+{
+   int factoryCalls = 0;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_command( "one", [&]( std::string_view name ) {
+      ++factoryCalls;
+      return std::make_shared<CmdOneOptions>( name );
+   } );
+
+   auto res = parser.parse_args( { "one", "-s", "first", "-n", "1" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   auto pCmdOne = findCommand<CmdOneOptions>( res, "one" );
+   ASSERT_NE( nullptr, pCmdOne );
+   EXPECT_EQ( "first", pCmdOne->str.value_or( "" ) );
+   EXPECT_EQ( 1, pCmdOne->count.value_or( 0 ) );
+
+   res = parser.parse_args( { "one", "-s", "second" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( pCmdOne, findCommand<CmdOneOptions>( res, "one" ) );
+   EXPECT_EQ( "second", pCmdOne->str.value_or( "" ) );
+   EXPECT_FALSE( pCmdOne->count.has_value() );
+   EXPECT_EQ( 1, factoryCalls );
+}
+
+TEST( ArgumentParserCommand, shouldRebuildTheCommandParserWhenFactoryIsReplaced )
+{
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   auto command = params.add_command<CmdOneOptions>( "cmd" );
+
+   auto res = parser.parse_args( { "cmd", "-s", "one" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   EXPECT_NE( nullptr, findCommand<CmdOneOptions>( res, "cmd" ) );
+
+   command.factory(
+         []( std::string_view name ) { return std::make_shared<CmdTwoOptions>( name ); } );
+
+   res = parser.parse_args( { "cmd", "--string", "two" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   auto pCmdTwo = findCommand<CmdTwoOptions>( res, "cmd" );
+   ASSERT_NE( nullptr, pCmdTwo );
+   EXPECT_EQ( "two", pCmdTwo->str.value_or( "" ) );
+}
+
+TEST( ArgumentParserCommand, shouldSelectCommandsByPrefixWhenAllowed )
+{
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout ).allow_command_prefixes();
+   auto params = parser.params();
+   params.add_command<CmdOneOptions>( "one" );
+   params.add_command<CmdTwoOptions>( "two" );
+
+   auto res = parser.parse_args( { "o", "-s", "first" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   auto pCmdOne = findCommand<CmdOneOptions>( res, "one" );
+   ASSERT_NE( nullptr, pCmdOne );
+   EXPECT_EQ( "first", pCmdOne->str.value_or( "" ) );
+
+   res = parser.parse_args( { "tw", "--string", "second" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   EXPECT_NE( nullptr, findCommand<CmdTwoOptions>( res, "two" ) );
+}
@@ -254,6 +254,32 @@ TEST( ArgumentParserCommandHelpTest, shouldDisplayCommandDescriptionInCommandHel
    EXPECT_EQ( 1, countDescr ) << "----\n" << help;
 }
 
+TEST( ArgumentParserCommandHelpTest, shouldDisplayChangedProgramAndDescriptionInCommandHelp )
+{
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   parser.config().program( "testing" ).cout( strout );
+   auto command = params.add_command<CmdOneOptions>( "one" ).help( "Old description." );
+
+   auto res = parser.parse_args( { "one", "--help" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_TRUE( strHasTexts( strout.str(), { "testing one", "Old description." } ) );
+
+   // -- WHEN the program and the command are changed after the command was parsed
+   strout.str( "" );
+   parser.config().program( "renamed" );
+   command.help( "New description." );
+   res = parser.parse_args( { "one", "--help" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+
+   // -- THEN
+   auto help = strout.str();
+   EXPECT_TRUE( strHasTexts( help, { "renamed one", "New description." } ) ) << help;
+   EXPECT_FALSE( strHasText( help, "testing one" ) ) << help;
+   EXPECT_FALSE( strHasText( help, "Old description." ) ) << help;
+}
+
 TEST( ArgumentParserCommandHelpTest, shouldDisplayCommandHelpForDeepestCommandOnly )
 {
    std::stringstream strout;
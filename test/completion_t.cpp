@@ -0,0 +1,194 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace argumentum;
+using namespace testing;
+
+namespace {
+struct BuildOptions : public argumentum::CommandOptions
+{
+   std::string target;
+   bool verbose = false;
+
+   using CommandOptions::CommandOptions;
+
+   void add_parameters( ParameterConfig& params ) override
+   {
+      params.add_parameter( target, "--target" )
+            .nargs( 1 )
+            .choices( { "debug", "release" } )
+            .help( "The build type." );
+      params.add_parameter( verbose, "--verbose" ).help( "Show the commands." );
+   }
+};
+
+struct Program
+{
+   std::string color;
+   std::vector<std::string> files;
+   bool all = false;
+   bool alpha = false;
+   std::string mode;
+   std::stringstream strout;
+   argument_parser parser;
+
+   Program()
+   {
+      parser.config().program( "prog" ).cout( strout ).completion();
+      auto params = parser.params();
+      params.add_parameter( all, "-a", "--all" ).help( "Use all of them.\nAnd more." );
+      params.add_parameter( alpha, "--alpha" ).help( "The first: alpha" );
+      params.add_parameter( color, "-c", "--color" ).nargs( 1 ).choices( { "red", "green" } );
+      params.add_parameter( mode, "mode" ).nargs( 1 ).choices( { "fast", "full", "safe" } );
+      params.add_parameter( files, "files" ).minargs( 0 );
+      params.add_command<BuildOptions>( "build" ).help( "Build the program." );
+      params.add_command<BuildOptions>( "bundle" );
+   }
+
+   std::string complete( const std::vector<std::string>& args )
+   {
+      strout.str( "" );
+      auto res = parser.parse_args( args );
+      EXPECT_TRUE( res.has_exited() );
+      EXPECT_FALSE( static_cast<bool>( res ) );
+      return strout.str();
+   }
+};
+}   // namespace
+
+TEST( Completion, shouldCompleteOptionNamesByPrefix )
+{
+   Program program;
+   EXPECT_EQ( "--all\n--alpha\n", program.complete( { "__complete", "bash", "--al" } ) );
+   EXPECT_EQ( "--color\n", program.complete( { "__complete", "bash", "--c" } ) );
+   EXPECT_EQ( "", program.complete( { "__complete", "bash", "--x" } ) );
+   EXPECT_EQ( "--all\n--alpha\n--color\n--help\n-a\n-c\n-h\n",
+         program.complete( { "__complete", "bash", "-" } ) );
+}
+
+TEST( Completion, shouldCompleteChoicesOfOptionValues )
+{
+   Program program;
+   EXPECT_EQ( "green\n", program.complete( { "__complete", "bash", "--color", "g" } ) );
+   EXPECT_EQ( "red\ngreen\n", program.complete( { "__complete", "bash", "-ac", "" } ) );
+   EXPECT_EQ( "--color=red\n", program.complete( { "__complete", "bash", "--color=r" } ) );
+
+   // The option has its value and the next word is the positional mode.
+   EXPECT_EQ( "fast\nfull\n", program.complete( { "__complete", "bash", "-c", "red", "f" } ) );
+}
+
+TEST( Completion, shouldCompleteCommandsAndPositionalChoices )
+{
+   Program program;
+   EXPECT_EQ( "build\nbundle\n", program.complete( { "__complete", "bash", "bu" } ) );
+   EXPECT_EQ( "build\nbundle\nfast\nfull\nsafe\n",
+         program.complete( { "__complete", "bash", "" } ) );
+
+   // The mode has its value.  The files have no choices.
+   EXPECT_EQ( "build\nbundle\n", program.complete( { "__complete", "bash", "safe", "" } ) );
+
+   // Options are not completed after the end of options.
+   EXPECT_EQ( "full\n", program.complete( { "__complete", "bash", "--", "fu" } ) );
+}
+
+TEST( Completion, shouldCompleteTheOptionsOfTheSelectedCommand )
+{
+   Program program;
+   EXPECT_EQ( "--target\n", program.complete( { "__complete", "bash", "build", "--t" } ) );
+   EXPECT_EQ( "release\n",
+         program.complete( { "__complete", "bash", "--all", "build", "--target", "r" } ) );
+   EXPECT_EQ( "--help\n--target\n--verbose\n",
+         program.complete( { "__complete", "bash", "bundle", "--" } ) );
+}
+
+TEST( Completion, shouldWriteDescriptionsForZshAndFish )
+{
+   Program program;
+   EXPECT_EQ( "--all:Use all of them.\n--alpha:The first: alpha\n",
+         program.complete( { "__complete", "zsh", "--al" } ) );
+   EXPECT_EQ( "--color=red\n", program.complete( { "__complete", "zsh", "--color=r" } ) );
+   EXPECT_EQ( "--all\tUse all of them.\n--alpha\tThe first: alpha\n",
+         program.complete( { "__complete", "fish", "--al" } ) );
+   EXPECT_EQ( "build\tBuild the program.\nbundle\n",
+         program.complete( { "__complete", "fish", "b" } ) );
+}
+
+TEST( Completion, shouldWriteCompletionScripts )
+{
+   Program program;
+   auto bash = program.complete( { "__complete", "script", "bash" } );
+   EXPECT_NE( std::string::npos, bash.find( "complete -o default -F _prog 'prog'" ) );
+   EXPECT_NE( std::string::npos, bash.find( "'0:build') scope=1 ;;" ) );
+   EXPECT_NE( std::string::npos, bash.find( "'1:--target')" ) );
+   EXPECT_NE( std::string::npos, bash.find( "'release'" ) );
+
+   auto zsh = program.complete( { "__complete", "script", "zsh" } );
+   EXPECT_EQ( 0, zsh.find( "#compdef prog\n" ) );
+   EXPECT_NE( std::string::npos, zsh.find( "'--alpha:The first: alpha'" ) );
+
+   auto fish = program.complete( { "__complete", "script", "fish" } );
+   EXPECT_NE( std::string::npos, fish.find( "complete -c 'prog' -f -a '(__prog_complete)'" ) );
+   EXPECT_NE( std::string::npos, fish.find( "'build'\\t'Build the program.'" ) );
+
+   EXPECT_EQ( "", program.complete( { "__complete", "script", "cmd" } ) );
+}
+
+TEST( Completion, shouldRegisterScriptsForTheBaseNameOfTheProgram )
+{
+   Program program;
+   program.parser.config().program( "/usr/local/bin/prog" );
+   auto bash = program.complete( { "__complete", "script", "bash" } );
+   EXPECT_NE( std::string::npos, bash.find( "complete -o default -F _prog 'prog'" ) );
+
+   auto fish = program.complete( { "__complete", "script", "fish" } );
+   EXPECT_NE( std::string::npos, fish.find( "complete -c 'prog' -f -a '(__prog_complete)'" ) );
+}
+
+TEST( Completion, shouldNotWriteScriptsWithoutProgramName )
+{
+   Program program;
+   program.parser.config().program( "" );
+   EXPECT_EQ( "", program.complete( { "__complete", "script", "bash" } ) );
+   EXPECT_EQ( "", program.complete( { "__complete", "script", "zsh" } ) );
+   EXPECT_EQ( "", program.complete( { "__complete", "script", "fish" } ) );
+   EXPECT_NE( "", program.complete( { "__complete", "bash", "--al" } ) );
+}
+
+TEST( Completion, shouldParseTheArgumentsWhenCompletionIsNotEnabled )
+{
+   std::string mode;
+   std::vector<std::string> files;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_parameter( mode, "mode" ).nargs( 1 );
+   params.add_parameter( files, "files" ).minargs( 0 );
+
+   auto res = parser.parse_args( { "__complete", "bash", "--" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "__complete", mode );
+   EXPECT_EQ( "", strout.str() );
+}
+
+TEST( Completion, shouldCompleteInASession )
+{
+   Program program;
+   auto session = parse_session( program.parser );
+   for ( int i = 0; i < 2; ++i ) {
+      program.strout.str( "" );
+      auto& res = session.parse_args( { "__complete", "bash", "--al" } );
+      EXPECT_FALSE( static_cast<bool>( res ) );
+      EXPECT_TRUE( res.has_exited() );
+      EXPECT_EQ( "--all\n--alpha\n", program.strout.str() );
+   }
+
+   // The names are indexed again when the definition changes.
+   program.parser.params().add_parameter( program.all, "--alphabet" );
+   EXPECT_EQ( "--alpha\n--alphabet\n", program.complete( { "__complete", "bash", "--alp" } ) );
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include "vectors.h"
+
+#include <argumentum/argparse.h>
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace argumentum;
+using namespace testing;
+
+namespace {
+struct JobTargets
+{
+   int id = -1;
+   long count = -1;
+   bool verbose = false;
+   std::string queue;
+   std::vector<std::string> inputs;
+};
+
+struct RunOptions : public argumentum::CommandOptions
+{
+   int level = 0;
+   using CommandOptions::CommandOptions;
+
+protected:
+   void add_parameters( ParameterConfig& params ) override
+   {
+      params.add_parameter( level, "--level" ).nargs( 1 );
+   }
+};
+
+void defineJobParameters( argument_parser& parser, JobTargets& prototype )
+{
+   auto params = parser.params();
+   params.add_parameter( prototype.id, "--id" ).nargs( 1 ).required();
+   params.add_parameter( prototype.count, "-c", "--count" ).nargs( 1 );
+   params.add_parameter( prototype.verbose, "-v", "--verbose" );
+   params.add_parameter( prototype.queue, "-q", "--queue" ).nargs( 1 ).absent( "default" );
+   params.add_parameter( prototype.inputs, "inputs" ).minargs( 0 );
+   params.add_command<RunOptions>( "run" );
+}
+}   // namespace
+
+TEST( ConcurrentParse, shouldSetBoundTargetsInsteadOfPrototype )
+{
+   JobTargets prototype;
+   auto parser = argument_parser{};
+   defineJobParameters( parser, prototype );
+
+   JobTargets targets;
+   auto session = parse_session( parser, prototype, targets );
+   auto& res = session.parse_args( { "--id", "3", "-v", "a", "b" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 3, targets.id );
+   EXPECT_EQ( 0, targets.count );
+   EXPECT_TRUE( targets.verbose );
+   EXPECT_EQ( "default", targets.queue );
+   EXPECT_TRUE( vector_eq( { "a", "b" }, targets.inputs ) );
+
+   EXPECT_EQ( -1, prototype.id );
+   EXPECT_EQ( -1, prototype.count );
+   EXPECT_FALSE( prototype.verbose );
+   EXPECT_TRUE( prototype.queue.empty() );
+   EXPECT_TRUE( prototype.inputs.empty() );
+}
+
+TEST( ConcurrentParse, shouldCreateCommandOptionsForEachSession )
+{
+   JobTargets prototype;
+   auto parser = argument_parser{};
+   defineJobParameters( parser, prototype );
+
+   JobTargets first;
+   JobTargets second;
+   auto firstSession = parse_session( parser, prototype, first );
+   auto secondSession = parse_session( parser, prototype, second );
+
+   auto& res1 = firstSession.parse_args( { "--id", "1", "run", "--level", "5" } );
+   auto& res2 = secondSession.parse_args( { "--id", "2", "run", "--level", "7" } );
+   ASSERT_TRUE( static_cast<bool>( res1 ) );
+   ASSERT_TRUE( static_cast<bool>( res2 ) );
+   ASSERT_EQ( 1, res1.commands.size() );
+   ASSERT_EQ( 1, res2.commands.size() );
+   EXPECT_NE( res1.commands.front(), res2.commands.front() );
+   EXPECT_EQ( 5, std::dynamic_pointer_cast<RunOptions>( res1.commands.front() )->level );
+   EXPECT_EQ( 7, std::dynamic_pointer_cast<RunOptions>( res2.commands.front() )->level );
+}
+
+// Parse with one parser in many threads.  Build with ARGUMENTUM_SANITIZE_THREAD
+// to detect data races.
+TEST( ConcurrentParse, shouldParseWithOneParserInManyThreads )
+{
+   const int threadCount = 8;
+   const int parseCount = 300;
+
+   JobTargets prototype;
+   auto parser = argument_parser{};
+   defineJobParameters( parser, prototype );
+
+   // The first session completes the definition before the parser is shared.
+   auto firstSession = parse_session( parser );
+
+   std::atomic<int> failures{ 0 };
+   auto worker = [&]( int id ) {
+      JobTargets targets;
+      auto session = parse_session( parser, prototype, targets );
+      auto idArg = std::to_string( id );
+      auto inputArg = "in-" + idArg;
+      for ( int i = 0; i < parseCount; ++i ) {
+         auto countArg = std::to_string( i );
+         auto withCommand = i % 3 == 0;
+         std::vector<std::string> args{ "--id", idArg, "--count=" + countArg, inputArg };
+         if ( i % 2 == 0 )
+            args.push_back( "-v" );
+         if ( withCommand ) {
+            args.push_back( "run" );
+            args.push_back( "--level" );
+            args.push_back( countArg );
+         }
+
+         auto& res = session.parse_args( args );
+         bool ok = static_cast<bool>( res ) && targets.id == id && targets.count == i
+               && targets.verbose == ( i % 2 == 0 ) && targets.queue == "default"
+               && targets.inputs.size() == 1 && targets.inputs.front() == inputArg
+               && res.commands.size() == ( withCommand ? 1u : 0u );
+         if ( ok && withCommand ) {
+            auto pRun = std::dynamic_pointer_cast<RunOptions>( res.commands.front() );
+            ok = pRun && pRun->level == i;
+         }
+         if ( !ok )
+            ++failures;
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for ( int t = 0; t < threadCount; ++t )
+      threads.emplace_back( worker, t );
+   for ( auto& thread : threads )
+      thread.join();
+
+   EXPECT_EQ( 0, failures.load() );
+   EXPECT_EQ( -1, prototype.id );
+   EXPECT_TRUE( prototype.inputs.empty() );
+}
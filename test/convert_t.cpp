@@ -157,6 +157,45 @@ TEST( ArgumentParserConvertTest, shouldSupportOptionalCustomOptionTypesWith_from
    EXPECT_FALSE( static_cast<bool>( ignored ) );
 }
 
+namespace {
+struct CustomType_fromview_test
+{
+   std::string value;
+};
+}   // namespace
+
+namespace argumentum {
+template<>
+struct from_string<CustomType_fromview_test>
+{
+   static CustomType_fromview_test convert( std::string_view s )
+   {
+      return { std::string{ s.substr( 1 ) } };
+   }
+};
+}   // namespace argumentum
+
+TEST( ArgumentParserConvertTest, shouldSupportCustomOptionTypesWithStringView_from_string )
+{
+   static_assert( has_view_from_string<CustomType_fromview_test>::value );
+   static_assert( !has_view_from_string<CustomType_fromstring_test>::value );
+   static_assert( has_view_from_string<long>::value );
+
+   CustomType_fromview_test custom;
+   std::optional<CustomType_fromview_test> optionalCustom;
+
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( custom, "-c" ).nargs( 1 );
+   params.add_parameter( optionalCustom, "-o" ).nargs( 1 );
+
+   auto res = parser.parse_args( { "-c", "value", "-o", "other" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "alue", custom.value );
+   ASSERT_TRUE( static_cast<bool>( optionalCustom ) );
+   EXPECT_EQ( "ther", optionalCustom->value );
+}
+
 TEST( ArgumentParserConvertTest, shouldSupportVectorOfCustomTypesWith_from_string )
 {
    std::vector<CustomType_fromstring_test> custom;
@@ -287,6 +326,60 @@ TEST( ArgumentParserConvertTest, shouldSupportFloatingNumericTypes )
    EXPECT_EQ( OK, testType<long double>( "-32123.45", -32123.45, near ) );
 }
 
+TEST( ArgumentParserConvertTest, shouldSkipWhiteSpaceBeforeNumbers )
+{
+   auto near = []( const auto& a, const auto& b ) {
+      return abs( a - b ) < 1e-4;
+   };
+   EXPECT_EQ( OK, testType<int>( " 5", 5 ) );
+   EXPECT_EQ( OK, testType<int>( "\t-5", -5 ) );
+   EXPECT_EQ( OK, testType<unsigned>( " 7", 7 ) );
+   EXPECT_EQ( OK, testType<double>( " 2.5", 2.5, near ) );
+   EXPECT_EQ( OK, testType<double>( " -2.5", -2.5, near ) );
+}
+
+TEST( ArgumentParserConvertTest, shouldRejectWhiteSpaceAfterSigns )
+{
+   long count = 0;
+   double ratio = 0;
+
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( count, "--count" ).nargs( 1 );
+   params.add_parameter( ratio, "--ratio" ).nargs( 1 );
+
+   for ( auto text : { "- 0x10", "- 5", " - -5" } ) {
+      auto res = parser.parse_args( { std::string( "--count=" ) + text } );
+      EXPECT_FALSE( static_cast<bool>( res ) ) << text;
+      ASSERT_EQ( 1, res.errors.size() ) << text;
+      EXPECT_EQ( CONVERSION_ERROR, res.errors.front().errorCode ) << text;
+   }
+
+   for ( auto text : { "- 2.5", " - -5" } ) {
+      auto res = parser.parse_args( { std::string( "--ratio=" ) + text } );
+      EXPECT_FALSE( static_cast<bool>( res ) ) << text;
+      ASSERT_EQ( 1, res.errors.size() ) << text;
+      EXPECT_EQ( CONVERSION_ERROR, res.errors.front().errorCode ) << text;
+   }
+}
+
+TEST( ArgumentParserConvertTest, shouldAcceptUppercaseHexadecimalFloatPrefix )
+{
+   auto near = []( const auto& a, const auto& b ) {
+      return abs( a - b ) < 1e-4;
+   };
+   EXPECT_EQ( OK, testType<double>( "0X1p3", 8.0, near ) );
+   EXPECT_EQ( OK, testType<double>( "-0X1.8P1", -3.0, near ) );
+   EXPECT_EQ( OK, testType<float>( "0Xa", 10.0f, near ) );
+
+   EXPECT_EQ( 8.0, parse_float_strtod<double>( "0X1p3" ) );
+   EXPECT_EQ( 2.5, parse_float_strtod<double>( " 2.5" ) );
+#ifdef ARGUMENTUM_HAS_FLOAT_FROM_CHARS
+   EXPECT_EQ( 8.0, parse_float_from_chars<double>( "0X1p3" ) );
+   EXPECT_EQ( 2.5, parse_float_from_chars<double>( " 2.5" ) );
+#endif
+}
+
 TEST( ArgumentParserConvertTest, shouldSupportBoolType )
 {
    EXPECT_EQ( OK, testType<bool>( "1", true ) );
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace argumentum;
+
+namespace {
+struct CmdOptions : public argumentum::CommandOptions
+{
+   int value = 0;
+   using CommandOptions::CommandOptions;
+
+protected:
+   void add_parameters( ParameterConfig& params ) override
+   {
+      params.add_parameter( value, "--value" ).nargs( 1 ).env( "APP_VALUE" );
+   }
+};
+}   // namespace
+
+TEST( EnvVariable, shouldReadValueWhenOptionIsNotInArguments )
+{
+   int level = 0;
+   std::string name;
+   const char* environment[] = { "HOME=/home/user", "APP_LEVEL=3", "APP_NAME=", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().environment( environment );
+   auto params = parser.params();
+   params.add_parameter( level, "--level" ).nargs( 1 ).env( "APP_LEVEL" );
+   params.add_parameter( name, "--name" ).nargs( 1 ).env( "APP_NAME" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 3, level );
+   EXPECT_EQ( "", name );
+
+   res = parser.parse_args( { "--level", "5", "--name", "cli" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 5, level );
+   EXPECT_EQ( "cli", name );
+}
+
+TEST( EnvVariable, shouldPreferEnvironmentToDefault )
+{
+   int level = 0;
+   int count = 0;
+   const char* environment[] = { "APP_LEVEL=3", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().environment( environment );
+   auto params = parser.params();
+   params.add_parameter( level, "--level" ).nargs( 1 ).absent( 7 ).env( "APP_LEVEL" );
+   params.add_parameter( count, "--count" ).nargs( 1 ).absent( 2 ).env( "APP_COUNT" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 3, level );
+   EXPECT_EQ( 2, count );
+}
+
+TEST( EnvVariable, shouldSetRequiredOptionsFlagsAndVectors )
+{
+   std::optional<int> level;
+   bool verbose = false;
+   std::vector<std::string> paths;
+   const char* environment[] = {
+      "APP_VERBOSE=1", "APP_LEVEL=4", "APP_PATHS=/usr/lib:/lib", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().environment( environment );
+   auto params = parser.params();
+   params.add_parameter( level, "--level" ).nargs( 1 ).required().env( "APP_LEVEL" );
+   params.add_parameter( verbose, "-v" ).env( "APP_VERBOSE" );
+   params.add_parameter( paths, "--path" ).env( "APP_PATHS" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 4, level.value_or( 0 ) );
+   EXPECT_TRUE( verbose );
+   ASSERT_EQ( 1, paths.size() );
+   EXPECT_EQ( "/usr/lib:/lib", paths.front() );
+}
+
+TEST( EnvVariable, shouldReportInvalidValues )
+{
+   int level = 0;
+   std::string mode;
+   std::stringstream strout;
+   const char* environment[] = { "APP_LEVEL=high", "APP_MODE=slow", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().cout( strout ).environment( environment );
+   auto params = parser.params();
+   params.add_parameter( level, "--level" ).nargs( 1 ).env( "APP_LEVEL" );
+   params.add_parameter( mode, "--mode" ).nargs( 1 ).choices( { "fast" } ).env( "APP_MODE" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 2, res.errors.size() );
+   EXPECT_EQ( "--level", res.errors[0].option );
+   EXPECT_EQ( CONVERSION_ERROR, res.errors[0].errorCode );
+   EXPECT_EQ( "--mode", res.errors[1].option );
+   EXPECT_EQ( INVALID_CHOICE, res.errors[1].errorCode );
+}
+
+TEST( EnvVariable, shouldNotReadVariablesOfExclusiveGroupUsedInArguments )
+{
+   bool json = false;
+   bool yaml = false;
+   const char* environment[] = { "APP_YAML=1", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().environment( environment );
+   auto params = parser.params();
+   params.add_exclusive_group( "format" );
+   params.add_parameter( json, "--json" ).env( "APP_JSON" );
+   params.add_parameter( yaml, "--yaml" ).env( "APP_YAML" );
+   params.end_group();
+
+   auto res = parser.parse_args( { "--json" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_TRUE( json );
+   EXPECT_FALSE( yaml );
+
+   res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_FALSE( json );
+   EXPECT_TRUE( yaml );
+}
+
+TEST( EnvVariable, shouldShowHelpWhenEnvironmentDoesNotSetRequiredOptions )
+{
+   int a = 0;
+   int b = 0;
+   std::stringstream strout;
+   const char* environment[] = { nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().cout( strout ).environment( environment );
+   auto params = parser.params();
+   params.add_parameter( a, "--a" ).nargs( 1 ).required();
+   params.add_parameter( b, "--b" ).nargs( 1 ).env( "APP_B" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_TRUE( res.help_was_shown() );
+
+   const char* withRequired[] = { "APP_A=1", nullptr };
+   parser.config().environment( withRequired );
+   res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_TRUE( res.help_was_shown() );
+}
+
+TEST( EnvVariable, shouldNotShowHelpWhenEnvironmentSetsRequiredOptions )
+{
+   int a = 0;
+   std::stringstream strout;
+   const char* environment[] = { "APP_A=4", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().cout( strout ).environment( environment );
+   auto params = parser.params();
+   params.add_parameter( a, "--a" ).nargs( 1 ).required().env( "APP_A" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_FALSE( res.help_was_shown() );
+   EXPECT_EQ( 4, a );
+
+   const char* empty[] = { nullptr };
+   parser.config().environment( empty );
+   res = parser.parse_args( std::vector<std::string>{} );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_TRUE( res.help_was_shown() );
+}
+
+TEST( EnvVariable, shouldReadEnvironmentInCommandsAndSessions )
+{
+   const char* first[] = { "APP_VALUE=1", nullptr };
+   const char* second[] = { "APP_VALUE=2", nullptr };
+
+   auto parser = argument_parser{};
+   parser.config().environment( first );
+   auto params = parser.params();
+   params.add_command<CmdOptions>( "cmd" );
+
+   auto session = parse_session( parser );
+   auto& res = session.parse_args( { "cmd" } );
+   ASSERT_TRUE( static_cast<bool>( res ) );
+   auto pCmd = std::dynamic_pointer_cast<CmdOptions>( res.commands.front() );
+   ASSERT_NE( nullptr, pCmd );
+   EXPECT_EQ( 1, pCmd->value );
+
+   parser.config().environment( second );
+   ASSERT_TRUE( static_cast<bool>( session.parse_args( { "cmd" } ) ) );
+   EXPECT_EQ( 2, pCmd->value );
+
+   ASSERT_TRUE( static_cast<bool>( session.parse_args( { "cmd", "--value", "3" } ) ) );
+   EXPECT_EQ( 3, pCmd->value );
+}
+
+#if !defined( _WIN32 )
+TEST( EnvVariable, shouldReadProcessEnvironmentByDefault )
+{
+   std::string value;
+   setenv( "ARGUMENTUM_ENV_VARIABLE_TEST", "from-process", 1 );
+
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( value, "--value" ).nargs( 1 ).env( "ARGUMENTUM_ENV_VARIABLE_TEST" );
+
+   auto res = parser.parse_args( std::vector<std::string>{} );
+   unsetenv( "ARGUMENTUM_ENV_VARIABLE_TEST" );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( "from-process", value );
+}
+#endif
+
+TEST( EnvVariable, shouldRejectInvalidVariableNames )
+{
+   int level = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   EXPECT_THROW( params.add_parameter( level, "--level" ).env( "APP=LEVEL" ),
+         std::invalid_argument );
+}
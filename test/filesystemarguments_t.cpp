@@ -51,6 +51,39 @@ public:
    }
 };
 
+// A filesystem that counts the opened files.  The stamp of a file changes
+// when the file is replaced.
+class StampedTestFilesystem : public TestFilesystem
+{
+   std::map<std::string, int64_t> mVersions;
+
+public:
+   int openCount = 0;
+
+   std::unique_ptr<ArgumentStream> open( const std::string& filename ) override
+   {
+      ++openCount;
+      return TestFilesystem::open( filename );
+   }
+
+   std::optional<FileStamp> stamp( const std::string& filename ) override
+   {
+      auto iv = mVersions.find( filename );
+      if ( iv == mVersions.end() )
+         return {};
+
+      FileStamp stamp;
+      stamp.mtime = iv->second;
+      return stamp;
+   }
+
+   void replaceFile( const std::string& name, std::vector<std::string>&& content )
+   {
+      addFile( name, std::move( content ) );
+      ++mVersions[name];
+   }
+};
+
 TEST( FilesystemArguments, shouldReadArgumentsFromFilesystem )
 {
    auto pfs = std::make_shared<TestFilesystem>();
@@ -149,3 +182,195 @@ TEST( FilesystemArguments, shouldUseDefaultFilesystemWhenNoneIsDefined )
    std::cout << "No filesystem. Test skipped.\n";
 #endif
 }
+
+TEST( FilesystemArguments, shouldReadSmallAndLargeFilesInMappedFilesystem )
+{
+#if HAVE_FILESYSTEM
+   auto tmpdir = fs::temp_directory_path() / "xdata";
+   if ( !fs::exists( tmpdir ) )
+      fs::create_directory( tmpdir );
+   auto smallfile = tmpdir / "small.opt";
+   auto largefile = tmpdir / "large.opt";
+
+   auto f = std::ofstream( smallfile );
+   f << "--alpha\nsmall";
+   f.close();
+
+   f = std::ofstream( largefile );
+   for ( size_t size = 0; size < MappedFile::minMappedSize; size += 12 )
+      f << "--beta\nlarge\n";
+   f.close();
+
+   auto parser = argument_parser{};
+   parser.config().filesystem( std::make_shared<MappedFilesystem>() );
+   auto params = parser.params();
+   std::string alpha;
+   std::string beta;
+   params.add_parameter( alpha, "--alpha" ).nargs( 1 );
+   params.add_parameter( beta, "--beta" ).nargs( 1 );
+
+   auto res =
+         parser.parse_args( { "@" + smallfile.generic_string(), "@" + largefile.generic_string() } );
+
+   EXPECT_TRUE( !!res );
+   EXPECT_EQ( "small", alpha );
+   EXPECT_EQ( "large", beta );
+#else
+   std::cout << "No filesystem. Test skipped.\n";
+#endif
+}
+
+TEST( FilesystemArguments, shouldSplitMappedFilesLikeGetline )
+{
+#if HAVE_FILESYSTEM && ARGUMENTUM_HAVE_MMAP
+   auto tmpdir = fs::temp_directory_path() / "xdata";
+   if ( !fs::exists( tmpdir ) )
+      fs::create_directory( tmpdir );
+   auto tmpfile = tmpdir / "mapped.opt";
+
+   std::vector<std::string> contents{ "", "\n", "one", "one\n", "one\ntwo", "one\n\n\ntwo\n",
+      "one\r\ntwo", "\n\none" };
+   std::string large;
+   for ( int i = 0; i < 20000; ++i )
+      large += "--file=" + std::to_string( i ) + "\n";
+   contents.push_back( large );
+
+   for ( auto& content : contents ) {
+      auto f = std::ofstream( tmpfile, std::ios::binary );
+      f << content;
+      f.close();
+
+      std::vector<std::string> expected;
+      std::istringstream input( content );
+      for ( std::string line; std::getline( input, line ); )
+         expected.push_back( line );
+
+      auto pStream = MappedFileArgumentStream::open( tmpfile.generic_string() );
+      ASSERT_NE( nullptr, pStream );
+
+      std::vector<std::string> peeked;
+      pStream->peek( [&]( std::string_view arg ) {
+         peeked.emplace_back( arg );
+         return ArgumentStream::peekNext;
+      } );
+      EXPECT_EQ( expected, peeked );
+
+      std::vector<std::string> actual;
+      for ( auto arg = pStream->next(); arg; arg = pStream->next() )
+         actual.emplace_back( *arg );
+      EXPECT_EQ( expected, actual );
+   }
+
+   EXPECT_EQ( nullptr, MappedFileArgumentStream::open( ( tmpdir / "missing.opt" ).string() ) );
+#else
+   std::cout << "No filesystem. Test skipped.\n";
+#endif
+}
+
+TEST( FilesystemArguments, shouldReadCachedFilesUntilTheyChange )
+{
+   auto pfs = std::make_shared<StampedTestFilesystem>();
+   pfs->replaceFile( "common.opt", { "--alpha", "1" } );
+   pfs->addFile( "unstamped.opt", { "--beta", "2" } );
+   auto pCache = std::make_shared<CachingFilesystem>( pfs );
+
+   int alpha = 0;
+   int beta = 0;
+   auto parser = argument_parser{};
+   parser.config().filesystem( pCache );
+   auto params = parser.params();
+   params.add_parameter( alpha, "--alpha" ).nargs( 1 );
+   params.add_parameter( beta, "--beta" ).nargs( 1 );
+
+   for ( int i = 0; i < 3; ++i ) {
+      auto res = parser.parse_args( { "@common.opt", "@unstamped.opt", "@common.opt" } );
+      EXPECT_TRUE( !!res );
+      EXPECT_EQ( 1, alpha );
+      EXPECT_EQ( 2, beta );
+   }
+
+   // The stamped file is read once, the other on every parse.
+   EXPECT_EQ( 4, pfs->openCount );
+   EXPECT_EQ( 1, pCache->stats().misses );
+   EXPECT_EQ( 5, pCache->stats().hits );
+
+   pfs->replaceFile( "common.opt", { "--alpha", "3" } );
+   auto res = parser.parse_args( { "@common.opt" } );
+   EXPECT_TRUE( !!res );
+   EXPECT_EQ( 3, alpha );
+   EXPECT_EQ( 2, pCache->stats().misses );
+
+   pCache->clear();
+   EXPECT_EQ( 0, pCache->stats().hits );
+   EXPECT_EQ( nullptr, pCache->open( "missing.opt" ) );
+}
+
+TEST( FilesystemArguments, shouldStampFilesInDefaultFilesystem )
+{
+#if HAVE_FILESYSTEM && ARGUMENTUM_HAVE_STAT
+   auto tmpdir = fs::temp_directory_path() / "xdata";
+   if ( !fs::exists( tmpdir ) )
+      fs::create_directory( tmpdir );
+   auto tmpfile = tmpdir / "stamped.opt";
+   auto f = std::ofstream( tmpfile );
+   f << "--alpha\nfirst";
+   f.close();
+
+   auto filename = tmpfile.generic_string();
+   auto pCache = std::make_shared<CachingFilesystem>();
+   auto stamp = pCache->stamp( filename );
+   ASSERT_TRUE( stamp.has_value() );
+   EXPECT_FALSE( pCache->stamp( ( tmpdir / "missing.opt" ).generic_string() ).has_value() );
+
+   auto parser = argument_parser{};
+   parser.config().filesystem( pCache );
+   auto params = parser.params();
+   std::string alpha;
+   params.add_parameter( alpha, "--alpha" ).nargs( 1 );
+
+   EXPECT_TRUE( !!parser.parse_args( { "@" + filename } ) );
+   EXPECT_TRUE( !!parser.parse_args( { "@" + filename } ) );
+   EXPECT_EQ( "first", alpha );
+   EXPECT_EQ( 1, pCache->stats().hits );
+
+   f = std::ofstream( tmpfile );
+   f << "--alpha\nsecond-value";
+   f.close();
+   EXPECT_NE( *stamp, *pCache->stamp( filename ) );
+
+   EXPECT_TRUE( !!parser.parse_args( { "@" + filename } ) );
+   EXPECT_EQ( "second-value", alpha );
+   EXPECT_EQ( 2, pCache->stats().misses );
+#else
+   std::cout << "No filesystem. Test skipped.\n";
+#endif
+}
+
+TEST( FilesystemArguments, shouldReadQuotedResponseFiles )
+{
+#if HAVE_FILESYSTEM
+   auto tmpdir = fs::temp_directory_path() / "xdata";
+   if ( !fs::exists( tmpdir ) )
+      fs::create_directory( tmpdir );
+   auto tmpfile = tmpdir / "quoted.rsp";
+   auto f = std::ofstream( tmpfile );
+   f << "--define 'NAME=a b' \"c d.txt\"\ne\\ f.txt\n";
+   f.close();
+
+   auto parser = argument_parser{};
+   parser.config().filesystem( std::make_shared<QuotedFilesystem>() );
+   auto params = parser.params();
+   std::string define;
+   std::vector<std::string> files;
+   params.add_parameter( define, "--define" ).nargs( 1 );
+   params.add_parameter( files, "files" ).minargs( 1 );
+
+   auto res = parser.parse_args( { "@" + tmpfile.generic_string() } );
+
+   EXPECT_TRUE( !!res );
+   EXPECT_EQ( "NAME=a b", define );
+   EXPECT_EQ( ( std::vector<std::string>{ "c d.txt", "e f.txt" } ), files );
+#else
+   std::cout << "No filesystem. Test skipped.\n";
+#endif
+}
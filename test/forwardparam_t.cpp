@@ -2,6 +2,7 @@
 // License: MPL2. See LICENSE in the root of the project.
 
 #include <argumentum/argparse.h>
+#include <argumentum/../../src/argumentlexer.h>
 
 #include <gtest/gtest.h>
 #include <string>
@@ -107,3 +108,48 @@ TEST( ForwardParam, shouldEscapeConsecutiveCommaInParams )
    EXPECT_EQ( ",,first-escaped,,", forward[1] );
    EXPECT_EQ( "second,combined,", forward[2] );
 }
+
+TEST( ForwardParam, shouldSplitForwardedArgumentsIntoViews )
+{
+   std::string_view args = "one,two,,escaped,three";
+   ForwardedArgumentSplitter splitter( args );
+   EXPECT_EQ( 3, splitter.countRemaining() );
+
+   auto arg = splitter.next();
+   ASSERT_TRUE( arg.has_value() );
+   EXPECT_EQ( "one", *arg );
+   EXPECT_EQ( args.data(), arg->data() );
+   EXPECT_EQ( 2, splitter.countRemaining() );
+
+   arg = splitter.next();
+   ASSERT_TRUE( arg.has_value() );
+   EXPECT_EQ( "two,escaped", *arg );
+
+   arg = splitter.next();
+   ASSERT_TRUE( arg.has_value() );
+   EXPECT_EQ( "three", *arg );
+   EXPECT_EQ( args.data() + args.size() - 5, arg->data() );
+
+   EXPECT_FALSE( splitter.next().has_value() );
+   EXPECT_EQ( 0, splitter.countRemaining() );
+}
+
+TEST( ForwardParam, shouldAppendManyForwardedArguments )
+{
+   std::vector<std::string> forward;
+
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( forward, "--forward" ).forward( true );
+
+   std::string option = "--forward";
+   for ( int i = 0; i < 1000; ++i )
+      option += ",-f" + std::to_string( i );
+
+   auto res = parser.parse_args( { option } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+
+   ASSERT_EQ( 1000, forward.size() );
+   EXPECT_EQ( "-f0", forward.front() );
+   EXPECT_EQ( "-f999", forward.back() );
+}
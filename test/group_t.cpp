@@ -227,3 +227,76 @@ TEST( ArgumentParserGroupsTest, shouldNotAddDefaultHelpToGroupWhenHelpNotDefined
    EXPECT_TRUE( longInGroup.has_value() );
    EXPECT_FALSE( longInGroup.value_or( true ) );
 }
+
+TEST( ArgumentParserGroupsTest, shouldReportGroupErrorsInTheOrderOfGroupNames )
+{
+   int a = 0, b = 0, c = 0, d = 0, e = 0;
+
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   parser.config().cout( strout );
+   params.add_exclusive_group( "beta" );
+   params.add_parameter( a, "--a" ).nargs( 0 );
+   params.add_parameter( b, "--b" ).nargs( 0 );
+   params.add_exclusive_group( "Alpha" );
+   params.add_parameter( c, "--c" ).nargs( 0 );
+   params.add_parameter( d, "--d" ).nargs( 0 );
+   params.add_group( "gamma" ).required( true );
+   params.add_parameter( e, "--e" ).nargs( 0 );
+   params.end_group();
+
+   // The options are used in the reverse order of definition.
+   auto res = parser.parse_args( { "--d", "--b", "--c", "--a" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 3, res.errors.size() );
+   EXPECT_EQ( EXCLUSIVE_OPTION, res.errors[0].errorCode );
+   EXPECT_EQ( "--c", res.errors[0].option );
+   EXPECT_EQ( EXCLUSIVE_OPTION, res.errors[1].errorCode );
+   EXPECT_EQ( "--a", res.errors[1].option );
+   EXPECT_EQ( MISSING_OPTION_GROUP, res.errors[2].errorCode );
+   EXPECT_EQ( "gamma", res.errors[2].option );
+
+   res = parser.parse_args( { "--d", "--a", "--e" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+}
+
+TEST( ArgumentParserGroupsTest, shouldSatisfyRequiredGroupThroughSharedValue )
+{
+   int value = 0;
+
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   parser.config().cout( strout );
+   params.add_group( "values" ).required( true );
+   params.add_parameter( value, "--value" ).nargs( 1 );
+   params.end_group();
+   params.add_parameter( value, "--other" ).nargs( 1 );
+
+   auto res = parser.parse_args( { "--other", "1" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 1, value );
+}
+
+TEST( ArgumentParserGroupsTest, shouldFindGroupsWithoutRegardToCase )
+{
+   int first = 0, second = 0;
+
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   parser.config().cout( strout );
+   params.add_exclusive_group( "Ints" );
+   params.add_parameter( first, "--first" ).nargs( 0 );
+   params.end_group();
+   EXPECT_THROW( params.add_group( "INTS" ), argumentum::MixingGroupTypes );
+   params.add_exclusive_group( "iNTs" );
+   params.add_parameter( second, "--second" ).nargs( 0 );
+   params.end_group();
+
+   auto res = parser.parse_args( { "--first", "--second" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_EQ( EXCLUSIVE_OPTION, res.errors[0].errorCode );
+}
@@ -665,3 +665,68 @@ TEST( ArgumentParserHelpTest, shouldUseSamePositionalMetavarNameInUsageAndHelp )
    EXPECT_EQ( 0, count["mpos"] );
    EXPECT_EQ( 2, count["MPOS"] );
 }
+
+TEST( ArgumentParserHelpTest, shouldRenderHelpAgainWhenDefinitionChanges )
+{
+   int dummy;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   auto group = params.add_group( "simple" );
+   auto first = params.add_parameter( dummy, "--first" ).nargs( 0 ).help( "first:help" );
+   params.end_group();
+
+   auto help = getTestHelp( parser, HelpFormatter() );
+   EXPECT_EQ( help, getTestHelp( parser, HelpFormatter() ) );
+   EXPECT_NE( std::string::npos, help.find( "first:help" ) );
+
+   first.help( "first:changed" );
+   help = getTestHelp( parser, HelpFormatter() );
+   EXPECT_NE( std::string::npos, help.find( "first:changed" ) );
+
+   params.add_parameter( dummy, "--second" ).nargs( 0 );
+   help = getTestHelp( parser, HelpFormatter() );
+   EXPECT_NE( std::string::npos, help.find( "--second" ) );
+
+   group.title( "Simple group" );
+   help = getTestHelp( parser, HelpFormatter() );
+   EXPECT_NE( std::string::npos, help.find( "Simple group:" ) );
+
+   parser.config().description( "A changed description." );
+   help = getTestHelp( parser, HelpFormatter() );
+   EXPECT_NE( std::string::npos, help.find( "A changed description." ) );
+}
+
+TEST( ArgumentParserHelpTest, shouldCacheHelpForEachTextWidth )
+{
+   int dummy;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( dummy, "--first" )
+         .nargs( 0 )
+         .help( "A long description that has to be wrapped when the text is narrow." );
+
+   auto narrow = HelpFormatter();
+   narrow.setTextWidth( 40 );
+   auto narrowHelp = getTestHelp( parser, narrow );
+   auto wideHelp = getTestHelp( parser, HelpFormatter() );
+   EXPECT_NE( narrowHelp, wideHelp );
+   EXPECT_EQ( narrowHelp, getTestHelp( parser, narrow ) );
+   EXPECT_EQ( wideHelp, getTestHelp( parser, HelpFormatter() ) );
+}
+
+TEST( ArgumentParserHelpTest, shouldPrecomputeHelpWhenDefinitionIsVerified )
+{
+   int dummy;
+   auto parser = argument_parser{};
+   parser.config().precompute_help();
+   auto params = parser.params();
+   params.add_parameter( dummy, "--first" ).nargs( 0 );
+
+   auto& parserDef = parser.getDefinition();
+   auto revision = parserDef.getConfig().help_revision();
+   EXPECT_FALSE( parserDef.getHelpCache().hasGeneration( parserDef.getGeneration(), revision ) );
+
+   auto res = parser.parse_args( { "--first" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_TRUE( parserDef.getHelpCache().hasGeneration( parserDef.getGeneration(), revision ) );
+}
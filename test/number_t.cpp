@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <gtest/gtest.h>
+#include <limits>
 #include <vector>
 
 using namespace argumentum;
@@ -169,3 +170,82 @@ TEST( ParseFloat, shouldParseNegativeBinaryDoubleWithPrefix )
 }
 
 // TODO: MANY tests for parse_float
+
+TEST( ParseInt, shouldParseLimitsOfIntegralTypes )
+{
+   EXPECT_EQ( 127, parse_int<int8_t>( "127" ) );
+   EXPECT_EQ( -128, parse_int<int8_t>( "-128" ) );
+   EXPECT_THROW( parse_int<int8_t>( "128" ), std::out_of_range );
+   EXPECT_THROW( parse_int<int8_t>( "-129" ), std::out_of_range );
+
+   EXPECT_EQ( std::numeric_limits<long long>::max(), parse_int<long long>( "9223372036854775807" ) );
+   EXPECT_EQ( std::numeric_limits<long long>::min(), parse_int<long long>( "-9223372036854775808" ) );
+   EXPECT_THROW( parse_int<long long>( "9223372036854775808" ), std::out_of_range );
+   EXPECT_THROW( parse_int<long long>( "-9223372036854775809" ), std::out_of_range );
+
+   EXPECT_EQ( std::numeric_limits<unsigned long long>::max(),
+         parse_int<unsigned long long>( "0xffffffffffffffff" ) );
+   EXPECT_THROW( parse_int<unsigned long long>( "0x10000000000000000" ), std::out_of_range );
+   EXPECT_THROW( parse_int<unsigned>( "-1" ), std::out_of_range );
+}
+
+TEST( ParseInt, shouldIgnoreTrailingCharacters )
+{
+   EXPECT_EQ( 12, parse_int<int>( "12abc" ) );
+   EXPECT_EQ( 5, parse_int<int>( "0b1012" ) );
+   EXPECT_EQ( 7, parse_int<int>( "0o78" ) );
+   EXPECT_EQ( 0, parse_int<int>( "0" ) );
+   EXPECT_EQ( 0, parse_int<int>( "-0" ) );
+}
+
+TEST( ParseInt, shouldThrowWhenPrefixIsNotFollowedByDigits )
+{
+   EXPECT_THROW( parse_int<int>( "" ), std::invalid_argument );
+   EXPECT_THROW( parse_int<int>( "-" ), std::invalid_argument );
+   EXPECT_THROW( parse_int<int>( "0x" ), std::invalid_argument );
+   EXPECT_THROW( parse_int<int>( "0b2" ), std::invalid_argument );
+   EXPECT_THROW( parse_int<int>( "--0o" ), std::invalid_argument );
+}
+
+TEST( ParseFloat, shouldThrowOnInvalidInput )
+{
+   EXPECT_THROW( parse_float<double>( "" ), std::invalid_argument );
+   EXPECT_THROW( parse_float<double>( "abc" ), std::invalid_argument );
+   EXPECT_THROW( parse_float<double>( "-0d" ), std::invalid_argument );
+   EXPECT_THROW( parse_float<double>( "inf" ), std::out_of_range );
+}
+
+TEST( ParseFloat, shouldParseAllFloatingTypes )
+{
+   EXPECT_NEAR( 1.5f, parse_float<float>( "1.5" ), 1e-6 );
+   EXPECT_NEAR( -1.5, parse_float<double>( "--+-1.5" ), 1e-6 );
+   EXPECT_NEAR( 1.5e-3L, parse_float<long double>( "1.5e-3" ), 1e-9 );
+   EXPECT_NEAR( 0.25, parse_float<double>( "0x.4" ), 1e-9 );
+   EXPECT_NEAR( 12.5, parse_float<double>( "12.5kg" ), 1e-9 );
+}
+
+#ifdef ARGUMENTUM_HAS_FLOAT_FROM_CHARS
+TEST( ParseFloat, shouldConvertLikeStrtod )
+{
+   auto numbers = { "0", "-0", "1", "12.5", ".5", "1e5", "1E-5", "-2.345e3", "0d2.5", "-0d.5",
+      "0x1f", "-0x1.8p3", "0xa.3c5", "3.25xyz", "1e-30", "-+-7.125", "0X1p3", " 2.5", "0x", "0xg" };
+   for ( auto number : numbers ) {
+      EXPECT_EQ( parse_float_strtod<double>( number ), parse_float_from_chars<double>( number ) )
+            << number;
+      EXPECT_EQ( parse_float_strtod<float>( number ), parse_float_from_chars<float>( number ) )
+            << number;
+   }
+
+   auto invalid = { "", "x", "-", "0d", "+-0d", "- 5", " - -5" };
+   for ( auto text : invalid ) {
+      EXPECT_THROW( parse_float_strtod<double>( text ), std::invalid_argument ) << text;
+      EXPECT_THROW( parse_float_from_chars<double>( text ), std::invalid_argument ) << text;
+   }
+
+   auto large = { "1e400", "-1e400", "0x1p2000" };
+   for ( auto text : large ) {
+      EXPECT_THROW( parse_float_strtod<double>( text ), std::out_of_range ) << text;
+      EXPECT_THROW( parse_float_from_chars<double>( text ), std::out_of_range ) << text;
+   }
+}
+#endif
@@ -0,0 +1,200 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include <argumentum/argparse.h>
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace argumentum;
+
+namespace {
+struct CmdOptions : public argumentum::CommandOptions
+{
+   using CommandOptions::CommandOptions;
+};
+}   // namespace
+
+TEST( ParserDefinition, shouldFindOptionsBeforeAndAfterIndexing )
+{
+   int first = 0;
+   int second = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( first, "-f", "--first" ).nargs( 1 );
+   params.add_parameter( second, "--second" ).nargs( 1 );
+
+   const auto& parserDef = parser.getDefinition();
+   EXPECT_NE( nullptr, parserDef.findOption( "-f" ) );
+   EXPECT_NE( nullptr, parserDef.findOption( "--second" ) );
+   EXPECT_EQ( nullptr, parserDef.findOption( "--third" ) );
+
+   auto res = parser.parse_args( { "--first", "1", "--second", "2" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+
+   EXPECT_EQ( parserDef.findOption( "-f" ), parserDef.findOption( "--first" ) );
+   EXPECT_NE( nullptr, parserDef.findOption( "--second" ) );
+   EXPECT_EQ( nullptr, parserDef.findOption( "--third" ) );
+   EXPECT_NE( nullptr, parserDef.findOption( "--help" ) );
+}
+
+TEST( ParserDefinition, shouldFindOptionsAndCommandsAddedAfterParsing )
+{
+   int first = 0;
+   int third = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( first, "--first" ).nargs( 1 );
+
+   auto res = parser.parse_args( { "--first", "1" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+
+   params.add_parameter( third, "--third" ).nargs( 1 );
+   params.add_command<CmdOptions>( "cmd" );
+
+   const auto& parserDef = parser.getDefinition();
+   EXPECT_NE( nullptr, parserDef.findOption( "--third" ) );
+   EXPECT_NE( nullptr, parserDef.findCommand( "cmd" ) );
+
+   res = parser.parse_args( { "--first", "1", "--third", "3", "cmd" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 3, third );
+   ASSERT_EQ( 1, res.commands.size() );
+}
+
+TEST( ParserDefinition, shouldFindRenamedOptionsAfterParsing )
+{
+   int first = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   auto config = params.add_parameter( first, "--first" ).nargs( 1 );
+
+   auto res = parser.parse_args( { "--first", "1" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+
+   config.setLongName( "--renamed" );
+
+   const auto& parserDef = parser.getDefinition();
+   EXPECT_EQ( nullptr, parserDef.findOption( "--first" ) );
+   EXPECT_NE( nullptr, parserDef.findOption( "--renamed" ) );
+
+   res = parser.parse_args( { "--renamed", "2" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 2, first );
+}
+
+TEST( ParserDefinition, shouldDescribeIndexedOptions )
+{
+   int first = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( first, "-f", "--first" ).nargs( 1 ).help( "The first." );
+
+   auto res = parser.parse_args( { "-f", "1" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+
+   auto help = parser.describe_argument( "-f" );
+   EXPECT_EQ( "--first", help.long_name );
+   EXPECT_EQ( "The first.", help.help );
+   EXPECT_THROW( parser.describe_argument( "--second" ), std::invalid_argument );
+}
+
+TEST( ParserDefinition, shouldMatchCommandsByUnambiguousPrefix )
+{
+   auto parser = argument_parser{};
+   parser.config().allow_command_prefixes();
+   auto params = parser.params();
+   params.add_command<CmdOptions>( "status" );
+   params.add_command<CmdOptions>( "stash" );
+   params.add_command<CmdOptions>( "commit" );
+
+   const auto& parserDef = parser.getDefinition();
+   for ( int indexed = 0; indexed < 2; ++indexed ) {
+      auto pStatus = parserDef.findCommand( "status" );
+      ASSERT_NE( nullptr, pStatus );
+      EXPECT_EQ( pStatus, parserDef.matchCommand( "status" ) );
+      EXPECT_EQ( pStatus, parserDef.matchCommand( "stat" ) );
+      EXPECT_EQ( parserDef.findCommand( "stash" ), parserDef.matchCommand( "stas" ) );
+      EXPECT_EQ( parserDef.findCommand( "commit" ), parserDef.matchCommand( "c" ) );
+      EXPECT_EQ( nullptr, parserDef.matchCommand( "sta" ) );
+      EXPECT_EQ( nullptr, parserDef.matchCommand( "statuses" ) );
+      EXPECT_EQ( nullptr, parserDef.matchCommand( "" ) );
+      EXPECT_EQ( nullptr, parserDef.findCommand( "stat" ) );
+
+      auto res = parser.parse_args( { "commit" } );
+      EXPECT_TRUE( static_cast<bool>( res ) );
+   }
+}
+
+TEST( ParserDefinition, shouldMatchOnlyFullCommandNamesByDefault )
+{
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_command<CmdOptions>( "status" );
+
+   auto res = parser.parse_args( { "status" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+
+   const auto& parserDef = parser.getDefinition();
+   EXPECT_NE( nullptr, parserDef.matchCommand( "status" ) );
+   EXPECT_EQ( nullptr, parserDef.matchCommand( "stat" ) );
+}
+
+TEST( ParserDefinition, shouldFindDuplicatesWhileOptionsAreRegistered )
+{
+   std::vector<int> values( 1000 );
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   for ( size_t i = 0; i < values.size(); ++i )
+      params.add_parameter( values[i], "--option-" + std::to_string( i ) ).nargs( 1 );
+   params.add_command<CmdOptions>( "cmd" );
+
+   EXPECT_THROW( params.add_parameter( values[0], "--option-500" ), DuplicateOption );
+   EXPECT_THROW( params.add_command<CmdOptions>( "cmd" ), DuplicateCommand );
+
+   // A renamed option drops the index.  The old name becomes free and the new
+   // one is taken.
+   auto config = params.add_parameter( values[0], "--renamed" ).nargs( 1 );
+   config.setLongName( "--option-x" );
+   EXPECT_NO_THROW( params.add_parameter( values[1], "--renamed" ).nargs( 1 ) );
+   EXPECT_THROW( params.add_parameter( values[2], "--option-x" ), DuplicateOption );
+
+   const auto& parserDef = parser.getDefinition();
+   EXPECT_NE( nullptr, parserDef.findOption( "--option-999" ) );
+   EXPECT_NE( nullptr, parserDef.findCommand( "cmd" ) );
+}
+
+TEST( ParserDefinition, shouldShareTheIndexOfSuggestionsBetweenSessions )
+{
+   bool verbose = false;
+   bool force = false;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_parameter( verbose, "--verbose" );
+
+   auto first = parse_session( parser );
+   auto& res = first.parse_args( { "--vrebose" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_EQ( 1, res.errors.front().suggestions.size() );
+
+   const auto& parserDef = parser.getDefinition();
+   auto pIndex = parserDef.getNameIndexCache().getEditIndex( parserDef );
+
+   auto second = parse_session( parser );
+   auto& res2 = second.parse_args( { "--verbos" } );
+   EXPECT_FALSE( static_cast<bool>( res2 ) );
+   ASSERT_EQ( 1, res2.errors.size() );
+   EXPECT_EQ( 1, res2.errors.front().suggestions.size() );
+   EXPECT_EQ( pIndex, parserDef.getNameIndexCache().getEditIndex( parserDef ) );
+
+   // The index is rebuilt for a new generation of the definition.
+   params.add_parameter( force, "--force" );
+   auto& res3 = second.parse_args( { "--forse" } );
+   EXPECT_FALSE( static_cast<bool>( res3 ) );
+   ASSERT_EQ( 1, res3.errors.size() );
+   EXPECT_EQ( 1, res3.errors.front().suggestions.size() );
+   EXPECT_NE( pIndex, parserDef.getNameIndexCache().getEditIndex( parserDef ) );
+}
@@ -0,0 +1,253 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include "vectors.h"
+
+#include <argumentum/argparse.h>
+
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <sstream>
+
+using namespace argumentum;
+using namespace testing;
+
+namespace {
+// Counts the allocations that are passed to the default resource.
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+   size_t allocations = 0;
+
+private:
+   void* do_allocate( size_t bytes, size_t alignment ) override
+   {
+      ++allocations;
+      return std::pmr::get_default_resource()->allocate( bytes, alignment );
+   }
+
+   void do_deallocate( void* p, size_t bytes, size_t alignment ) override
+   {
+      std::pmr::get_default_resource()->deallocate( p, bytes, alignment );
+   }
+
+   bool do_is_equal( const std::pmr::memory_resource& other ) const noexcept override
+   {
+      return this == &other;
+   }
+};
+
+struct CmdOptions : public argumentum::CommandOptions
+{
+   int value = 0;
+   using CommandOptions::CommandOptions;
+
+protected:
+   void add_parameters( ParameterConfig& params ) override
+   {
+      params.add_parameter( value, "--value" ).nargs( 1 );
+   }
+};
+}   // namespace
+
+TEST( ParseSession, shouldResetResultAndValuesBetweenParses )
+{
+   int count = 0;
+   std::vector<std::string> files;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_parameter( count, "-n", "--count" ).nargs( 1 );
+   params.add_parameter( files, "files" ).minargs( 0 );
+
+   auto session = parse_session( parser );
+   auto& res = session.parse_args( { "-n", "notanumber", "--unknown", "a.txt" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_EQ( 2, res.errors.size() );
+   EXPECT_TRUE( res.errors_were_shown() );
+
+   auto& res2 = session.parse_args( { "-n", "3", "b.txt", "c.txt" } );
+   EXPECT_EQ( &res, &res2 );
+   EXPECT_TRUE( static_cast<bool>( res2 ) );
+   EXPECT_TRUE( res2.errors.empty() );
+   EXPECT_FALSE( res2.errors_were_shown() );
+   EXPECT_EQ( 3, count );
+   EXPECT_TRUE( vector_eq( { "b.txt", "c.txt" }, files ) );
+
+   auto& res3 = session.parse_args( { "d.txt" } );
+   EXPECT_TRUE( static_cast<bool>( res3 ) );
+   EXPECT_EQ( 0, count );
+   EXPECT_TRUE( vector_eq( { "d.txt" }, files ) );
+}
+
+TEST( ParseSession, shouldResetTargetsSetByAnotherContext )
+{
+   int x = 0;
+   int y = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( x, "--x" ).nargs( 1 );
+   params.add_parameter( y, "--y" ).nargs( 1 );
+
+   EXPECT_TRUE( static_cast<bool>( parser.parse_args( { "--y", "2" } ) ) );
+
+   auto session = parse_session( parser );
+   EXPECT_TRUE( static_cast<bool>( session.parse_args( { "--x", "5" } ) ) );
+   EXPECT_EQ( 5, x );
+
+   EXPECT_TRUE( static_cast<bool>( parser.parse_args( { "--y", "3" } ) ) );
+   EXPECT_EQ( 0, x );
+   EXPECT_EQ( 3, y );
+}
+
+TEST( ParseSession, shouldParseArgvAndViews )
+{
+   int count = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_parameter( count, "-n", "--count" ).nargs( 1 );
+
+   auto session = parse_session( parser );
+   const char* argv[] = { "prog", "--count", "5" };
+   auto& res = session.parse_args( 3, const_cast<char**>( argv ) );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 5, count );
+
+   auto views = std::vector<std::string_view>{ "-n", "7" };
+   EXPECT_TRUE( static_cast<bool>( session.parse_args( views ) ) );
+   EXPECT_EQ( 7, count );
+
+   EXPECT_FALSE( static_cast<bool>( session.parse_args( 0, nullptr ) ) );
+   ASSERT_EQ( 1, session.result().errors.size() );
+   EXPECT_EQ( INVALID_ARGV, session.result().errors.front().errorCode );
+}
+
+TEST( ParseSession, shouldClearCommandsBetweenParses )
+{
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   params.add_command<CmdOptions>( "cmd" );
+
+   auto session = parse_session( parser );
+   auto& res = session.parse_args( { "cmd", "--value", "4" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.commands.size() );
+   auto pCmd = std::dynamic_pointer_cast<CmdOptions>( res.commands.front() );
+   ASSERT_NE( nullptr, pCmd );
+   EXPECT_EQ( 4, pCmd->value );
+
+   session.parse_args( std::vector<std::string>{} );
+   EXPECT_TRUE( static_cast<bool>( session.result() ) );
+   EXPECT_TRUE( session.result().commands.empty() );
+}
+
+TEST( ParseSession, shouldShowHelpWhenRequiredArgumentsAreMissing )
+{
+   std::string input;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   params.add_parameter( input, "input" ).nargs( 1 );
+
+   auto session = parse_session( parser );
+   auto& res = session.parse_args( std::vector<std::string>{} );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_TRUE( res.help_was_shown() );
+   EXPECT_TRUE( res.has_exited() );
+   EXPECT_NE( std::string::npos, strout.str().find( "input" ) );
+
+   session.parse_args( { "in.txt" } );
+   EXPECT_TRUE( static_cast<bool>( session.result() ) );
+   EXPECT_FALSE( session.result().help_was_shown() );
+   EXPECT_FALSE( session.result().has_exited() );
+   EXPECT_EQ( "in.txt", input );
+}
+
+TEST( ParseSession, shouldFindOptionsRenamedAfterTheSessionWasCreated )
+{
+   int count = 0;
+   auto parser = argument_parser{};
+   auto params = parser.params();
+   auto config = params.add_parameter( count, "--count" ).nargs( 1 );
+
+   auto session = parse_session( parser );
+   EXPECT_TRUE( static_cast<bool>( session.parse_args( { "--count", "1" } ) ) );
+
+   config.setLongName( "--number" );
+   EXPECT_TRUE( static_cast<bool>( session.parse_args( { "--number", "2" } ) ) );
+   EXPECT_EQ( 2, count );
+}
+
+TEST( ParseSession, shouldReuseTheArenaOfTheResult )
+{
+   int count = 0;
+   std::stringstream strout;
+   CountingResource resource;
+   auto parser = argument_parser{};
+   parser.config().cout( strout ).memory_resource( &resource );
+   auto params = parser.params();
+   params.add_parameter( count, "-n" ).nargs( 1 );
+
+   auto session = parse_session( parser );
+   std::vector<std::string> args{ "--long-unknown-option-name", "a-long-ignored-argument" };
+   for ( int i = 0; i < 50; ++i )
+      args.push_back( "--another-long-unknown-option-" + std::to_string( i ) );
+
+   auto& res = session.parse_args( args );
+   EXPECT_EQ( 51, res.errors.size() );
+   EXPECT_EQ( "--another-long-unknown-option-49", res.errors.back().option );
+   EXPECT_TRUE( vector_eq( { "a-long-ignored-argument" }, res.ignoredArguments ) );
+   // The strings are allocated in a few large blocks.
+   auto allocations = resource.allocations;
+   EXPECT_LT( 0, allocations );
+   EXPECT_GT( res.errors.size(), allocations );
+
+   // The arena is released when the result is cleared and it grows in the
+   // same blocks on the next parse.
+   for ( int i = 0; i < 3; ++i )
+      session.parse_args( args );
+   EXPECT_EQ( 51, session.result().errors.size() );
+   EXPECT_GE( 4 * allocations, resource.allocations );
+
+   EXPECT_TRUE( static_cast<bool>( session.parse_args( { "-n", "1" } ) ) );
+}
+
+TEST( ParseSession, shouldKeepErrorsWhenResultIsMovedToAnotherResult )
+{
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+
+   auto res = parser.parse_args( { "--first-unknown-option-with-a-long-name", "ignored" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   res = parser.parse_args( { "--second-unknown-option-with-a-long-name" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_EQ( "--second-unknown-option-with-a-long-name", res.errors.front().option );
+   EXPECT_TRUE( res.ignoredArguments.empty() );
+}
+
+TEST( ParseSession, shouldUseOptionsReconfiguredAfterTheSessionWasCreated )
+{
+   int count = 0;
+   int level = 0;
+   std::stringstream strout;
+   auto parser = argument_parser{};
+   parser.config().cout( strout );
+   auto params = parser.params();
+   auto countConfig = params.add_parameter( count, "--count" ).nargs( 1 );
+   auto levelConfig = params.add_parameter( level, "--level" ).nargs( 1 );
+
+   auto session = parse_session( parser );
+   EXPECT_TRUE( static_cast<bool>( session.parse_args( { "--level", "1" } ) ) );
+
+   countConfig.required();
+   levelConfig.absent( 5 );
+   auto& res = session.parse_args( std::vector<std::string>{ "--unknown" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 2, res.errors.size() );
+   EXPECT_EQ( MISSING_OPTION, res.errors.back().errorCode );
+   EXPECT_EQ( 5, level );
+}
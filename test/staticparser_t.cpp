@@ -0,0 +1,194 @@
+// Copyright (c) 2026 Marko Mahnič
+// License: MPL2. See LICENSE in the root of the project.
+
+#include "vectors.h"
+
+#include <argumentum/argparse.h>
+
+#include <gtest/gtest.h>
+
+using namespace argumentum;
+using namespace testing;
+
+namespace {
+struct StaticOptions
+{
+   bool verbose = false;
+   int depth = 3;
+   std::optional<std::string> name;
+   std::vector<long> numbers;
+   std::string input;
+   std::vector<std::string> files;
+};
+
+struct StaticSchemaDef
+{
+   static constexpr auto parameters = make_static_schema(
+         static_option( "-v", "--verbose", &StaticOptions::verbose ),
+         static_option( "-d", "--depth", &StaticOptions::depth ).nargs( 1 ),
+         static_option( "--name", &StaticOptions::name ).nargs( 1 ),
+         static_option( "-n", &StaticOptions::numbers ),
+         static_positional( "input", &StaticOptions::input ),
+         static_positional( "files", &StaticOptions::files ) );
+};
+
+using parser_t = static_parser<StaticSchemaDef>;
+
+struct RequiredSchemaDef
+{
+   static constexpr auto parameters = make_static_schema(
+         static_option( "--depth", &StaticOptions::depth ).nargs( 1 ).required() );
+};
+
+struct TwoShortNamesSchemaDef
+{
+   static constexpr auto parameters =
+         make_static_schema( static_option( "-x", "-y", &StaticOptions::verbose ) );
+};
+
+struct SingleDashLongNameSchemaDef
+{
+   static constexpr auto parameters =
+         make_static_schema( static_option( "-abc", &StaticOptions::verbose ) );
+};
+
+struct LongNameInShortSlotSchemaDef
+{
+   static constexpr auto parameters =
+         make_static_schema( static_option( "--verbose", "--loud", &StaticOptions::verbose ) );
+};
+
+template<typename TSchema>
+constexpr bool hasValidNames()
+{
+   return staticparser::hasValidNames( TSchema::parameters.getInfos() );
+}
+}   // namespace
+
+TEST( StaticParser, shouldRejectInvalidNamesAtCompileTime )
+{
+   static_assert( hasValidNames<StaticSchemaDef>() );
+   static_assert( !hasValidNames<TwoShortNamesSchemaDef>() );
+   static_assert( !hasValidNames<SingleDashLongNameSchemaDef>() );
+   static_assert( !hasValidNames<LongNameInShortSlotSchemaDef>() );
+}
+
+TEST( StaticParser, shouldFindOptionsAtCompileTime )
+{
+   static_assert( parser_t::find_option( "-v" ) == 0 );
+   static_assert( parser_t::find_option( "--verbose" ) == 0 );
+   static_assert( parser_t::find_option( "--depth" ) == 1 );
+   static_assert( parser_t::find_option( "--name" ) == 2 );
+   static_assert( parser_t::find_option( "-n" ) == 3 );
+   static_assert( parser_t::find_option( "--missing" ) == -1 );
+   static_assert( parser_t::find_option( "-x" ) == -1 );
+   static_assert( parser_t::find_option( "input" ) == -1 );
+}
+
+TEST( StaticParser, shouldParseOptionsAndPositionalArguments )
+{
+   StaticOptions options;
+   parser_t parser;
+
+   auto res = parser.parse_args( options,
+         { "-v", "--depth", "5", "--name=fred", "in.txt", "-n", "1", "2", "--", "a", "-b" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_TRUE( options.verbose );
+   EXPECT_EQ( 5, options.depth );
+   ASSERT_TRUE( options.name.has_value() );
+   EXPECT_EQ( "fred", *options.name );
+   EXPECT_TRUE( vector_eq( { 1, 2 }, options.numbers ) );
+   EXPECT_EQ( "in.txt", options.input );
+   EXPECT_TRUE( vector_eq( { "a", "-b" }, options.files ) );
+}
+
+TEST( StaticParser, shouldKeepInitialValuesAsDefaults )
+{
+   StaticOptions options;
+   options.numbers = { 7 };
+   parser_t parser;
+
+   auto res = parser.parse_args( options, { "in.txt" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( 3, options.depth );
+   EXPECT_TRUE( vector_eq( { 7 }, options.numbers ) );
+
+   res = parser.parse_args( options, { "in.txt", "-n", "8" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_TRUE( vector_eq( { 8 }, options.numbers ) );
+}
+
+TEST( StaticParser, shouldParseShortOptionBundles )
+{
+   StaticOptions options;
+   parser_t parser;
+
+   auto res = parser.parse_args( options, { "-vd", "7", "in.txt" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_TRUE( options.verbose );
+   EXPECT_EQ( 7, options.depth );
+}
+
+TEST( StaticParser, shouldAcceptNegativeNumbers )
+{
+   StaticOptions options;
+   parser_t parser;
+
+   auto res = parser.parse_args( options, { "in.txt", "-d", "-2", "-n", "-5", "-6", "-7" } );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_EQ( -2, options.depth );
+   EXPECT_TRUE( vector_eq( { -5, -6, -7 }, options.numbers ) );
+   EXPECT_EQ( "in.txt", options.input );
+}
+
+TEST( StaticParser, shouldReportErrors )
+{
+   StaticOptions options;
+   parser_t parser;
+
+   auto res = parser.parse_args( options, { "in.txt", "--unknown", "-d", "x", "--verbose=1", "--name" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 4, res.errors.size() );
+   EXPECT_EQ( "--unknown", res.errors[0].option );
+   EXPECT_EQ( UNKNOWN_OPTION, res.errors[0].errorCode );
+   EXPECT_EQ( "--depth", res.errors[1].option );
+   EXPECT_EQ( CONVERSION_ERROR, res.errors[1].errorCode );
+   EXPECT_EQ( "--verbose", res.errors[2].option );
+   EXPECT_EQ( FLAG_PARAMETER, res.errors[2].errorCode );
+   EXPECT_EQ( "--name", res.errors[3].option );
+   EXPECT_EQ( MISSING_ARGUMENT, res.errors[3].errorCode );
+}
+
+TEST( StaticParser, shouldReportMissingRequiredOptions )
+{
+   StaticOptions options;
+   static_parser<RequiredSchemaDef> parser;
+
+   auto res = parser.parse_args( options, std::vector<std::string>{} );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   ASSERT_EQ( 1, res.errors.size() );
+   EXPECT_EQ( "--depth", res.errors[0].option );
+   EXPECT_EQ( MISSING_OPTION, res.errors[0].errorCode );
+
+   res = parser.parse_args( options, { "--depth", "1", "extra" } );
+   EXPECT_FALSE( static_cast<bool>( res ) );
+   EXPECT_TRUE( res.errors.empty() );
+   ASSERT_EQ( 1, res.ignoredArguments.size() );
+   EXPECT_EQ( "extra", res.ignoredArguments[0] );
+}
+
+TEST( StaticParser, shouldParseArgv )
+{
+   StaticOptions options;
+   parser_t parser;
+
+   char program[] = "program";
+   char verbose[] = "-v";
+   char input[] = "in.txt";
+   char* argv[] = { program, verbose, input, nullptr };
+
+   auto res = parser.parse_args( options, 3, argv );
+   EXPECT_TRUE( static_cast<bool>( res ) );
+   EXPECT_TRUE( options.verbose );
+   EXPECT_EQ( "in.txt", options.input );
+}
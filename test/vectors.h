@@ -2,6 +2,8 @@
 // License: MPL2. See LICENSE in the root of the project.
 
 #include <iostream>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 namespace testing {
@@ -32,4 +34,13 @@ bool vector_eq( const std::vector<T>& values, const std::vector<T>& var )
    return true;
 }
 
+// Compare strings with the strings in a container that uses a different
+// allocator, for example ParseResult::ignoredArguments.
+template<typename T, typename TAlloc,
+      typename = std::enable_if_t<!std::is_same_v<TAlloc, std::allocator<T>>>>
+bool vector_eq( const std::vector<std::string>& values, const std::vector<T, TAlloc>& var )
+{
+   return vector_eq( values, std::vector<std::string>( var.begin(), var.end() ) );
+}
+
 }   // namespace testing